@@ -29,6 +29,9 @@
 
 #define TOUCH_CS  33
 #define TOUCH_IRQ 36
+#define TOUCH_MOSI 32
+#define TOUCH_MISO 39
+#define TOUCH_CLK 25
 
 #define SD_CS     5
 
@@ -0,0 +1,89 @@
+/*
+ * Display SPI clock sweep with read-back verification
+ */
+
+#include "SpiSweep.h"
+
+// Half-byte table for the reflected CRC-32 (IEEE 802.3) polynomial
+static const uint32_t crcNibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ crcNibble[crc & 0x0F];
+        crc = (crc >> 4) ^ crcNibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// xorshift32 pattern; the seed differs per clock so a stale frame can't pass
+static inline uint16_t nextPattern(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (uint16_t)state;
+}
+
+bool spiSweepStep(TFT_eSPI &tft, uint32_t hz, int32_t x, int32_t y, int32_t w, int32_t h,
+                  uint16_t *buffer, SpiSweepStep &step)
+{
+    uint32_t pixels = (uint32_t)w * h;
+    uint32_t seed = hz ^ 0x9E3779B9;
+    uint32_t state = seed;
+    step.hz = hz;
+
+    // Pattern at the clock under test. pushRect() sends the buffer in the
+    // byte order readRect() returns, so the two compare directly.
+    for (uint32_t i = 0; i < pixels; i++)
+        buffer[i] = nextPattern(state);
+    step.writeCrc = crc32Update(0, buffer, pixels * 2);
+    tft.startWrite();
+    tft.getSPIinstance().setFrequency(hz);
+    tft.pushRect(x, y, w, h, buffer);
+    tft.endWrite();
+
+    tft.readRect(x, y, w, h, buffer);
+    step.readCrc = crc32Update(0, buffer, pixels * 2);
+    step.passed = step.readCrc == step.writeCrc;
+
+    // Only a failed step is worth the second pass that counts the damage
+    step.badPixels = 0;
+    if (!step.passed)
+    {
+        state = seed;
+        for (uint32_t i = 0; i < pixels; i++)
+        {
+            if (buffer[i] != nextPattern(state))
+                step.badPixels++;
+        }
+    }
+
+    // Fill throughput at the same clock
+    tft.startWrite();
+    tft.getSPIinstance().setFrequency(hz);
+    unsigned long start = micros();
+    tft.fillRect(0, 0, tft.width(), tft.height(), TFT_BLACK);
+    step.fillUs = micros() - start;
+    tft.endWrite();
+    step.fillMBps = step.fillUs ? (float)tft.width() * tft.height() * 2 / step.fillUs : 0.0f;
+
+    return step.passed;
+}
+
+int spiSweep(TFT_eSPI &tft, const uint32_t *freqs, int count, int32_t x, int32_t y, int32_t w, int32_t h,
+             uint16_t *buffer, SpiSweepStep *steps)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (!spiSweepStep(tft, freqs[i], x, y, w, h, buffer, steps[i]))
+            return i + 1;
+    }
+    return count;
+}
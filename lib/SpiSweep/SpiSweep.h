@@ -0,0 +1,44 @@
+/*
+ * Display SPI clock sweep with read-back verification
+ *
+ * Each step reclocks the display bus inside one write transaction, pushes a
+ * pseudo-random pattern, reads it back over MISO with readRect() (which runs
+ * at SPI_READ_FREQUENCY, so only the write clock is under test) and compares
+ * CRC-32s of what was sent and what the panel holds. A full-screen fill at
+ * the same clock gives the effective write throughput.
+ *
+ * The next transaction goes back to SPI_FREQUENCY, so the sweep leaves the
+ * bus as it found it.
+ */
+
+#ifndef SPI_SWEEP_H
+#define SPI_SWEEP_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+struct SpiSweepStep
+{
+    uint32_t hz;          // requested clock
+    bool passed;          // read-back CRC matched
+    uint32_t writeCrc;    // CRC-32 of the pattern sent
+    uint32_t readCrc;     // CRC-32 of the pixels read back
+    uint32_t badPixels;   // pixels that differ
+    uint32_t fillUs;      // full-screen fillRect
+    float fillMBps;       // fill throughput, MB/s of pixel data
+};
+
+// One step: pattern in the w x h area at (x, y), using buffer (w * h
+// pixels) for the pattern and the read-back
+bool spiSweepStep(TFT_eSPI &tft, uint32_t hz, int32_t x, int32_t y, int32_t w, int32_t h,
+                  uint16_t *buffer, SpiSweepStep &step);
+
+// Runs the steps in order and stops after the first failure. Returns the
+// number of steps run; the highest stable clock is the last one that
+// passed.
+int spiSweep(TFT_eSPI &tft, const uint32_t *freqs, int count, int32_t x, int32_t y, int32_t w, int32_t h,
+             uint16_t *buffer, SpiSweepStep *steps);
+
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len);
+
+#endif // SPI_SWEEP_H
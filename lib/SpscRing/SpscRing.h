@@ -0,0 +1,68 @@
+/*
+ * Lock-free single-producer/single-consumer ring
+ *
+ * One task may push and one other task may pop, on either core, without a
+ * mutex: each index is written by one side only and published with release
+ * ordering, so a popped slot is always fully written. N must be a power of
+ * two; the indices run freely and wrap through the mask.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, uint32_t N>
+class SpscRing
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    // Producer side
+    bool push(const T &item)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == N)
+            return false;
+        slots[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    uint32_t space() const
+    {
+        return N - (head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire));
+    }
+
+    // Consumer side
+    bool pop(T &item)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t)
+            return false;
+        item = slots[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+    }
+
+    // Either side; only a snapshot while the other side is running
+    uint32_t size() const
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+private:
+    T slots[N];
+    std::atomic<uint32_t> head; // next slot to write, owned by the producer
+    std::atomic<uint32_t> tail; // next slot to read, owned by the consumer
+};
+
+#endif // SPSC_RING_H
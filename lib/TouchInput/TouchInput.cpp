@@ -0,0 +1,265 @@
+/*
+ * Interrupt-driven XPT2046 touch input
+ */
+
+#include "TouchInput.h"
+
+// XPT2046 control bytes: start bit, channel, 12-bit differential mode.
+// PD1:PD0 = 00 keeps PENIRQ enabled between conversions.
+#define XPT_READ_X 0xD0
+#define XPT_READ_Y 0x90
+#define XPT_READ_Z1 0xB0
+#define XPT_READ_Z2 0xC0
+
+// The interrupt handler has no argument, so it reaches the active instance here
+static TouchInput *activeTouch = nullptr;
+
+bool TouchInput::begin(const TouchPins &touchPins, const TouchCalibration &cal, int16_t width, int16_t height)
+{
+    if (activeTouch)
+        return false;
+
+    pins = touchPins;
+    calibration = cal;
+    panelW = width;
+    panelH = height;
+
+    pinMode(pins.clk, OUTPUT);
+    pinMode(pins.mosi, OUTPUT);
+    pinMode(pins.cs, OUTPUT);
+    pinMode(pins.miso, INPUT);
+    pinMode(pins.irq, INPUT);
+    digitalWrite(pins.cs, HIGH);
+    digitalWrite(pins.clk, LOW);
+
+    // One dummy conversion leaves the controller in PENIRQ mode
+    digitalWrite(pins.cs, LOW);
+    transfer(XPT_READ_X);
+    digitalWrite(pins.cs, HIGH);
+
+    activeTouch = this;
+    if (xTaskCreatePinnedToCore(taskEntry, "touch", 3072, this, 2, &task, 0) != pdPASS)
+    {
+        activeTouch = nullptr;
+        return false;
+    }
+    attachInterrupt(digitalPinToInterrupt(pins.irq), onIrq, FALLING);
+    return true;
+}
+
+bool TouchInput::waitForTap(TouchEvent &down, uint32_t timeoutMs)
+{
+    bool pressed = false;
+    unsigned long start = millis();
+    while (timeoutMs == 0 || millis() - start < timeoutMs)
+    {
+        TouchEvent event;
+        if (!poll(event))
+        {
+            delay(5);
+            continue;
+        }
+        if (event.type == TOUCH_DOWN)
+        {
+            down = event;
+            pressed = true;
+        }
+        else if (pressed)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TouchStats TouchInput::getStats() const
+{
+    TouchStats stats;
+    stats.interrupts = interrupts.load(std::memory_order_relaxed);
+    stats.presses = presses.load(std::memory_order_relaxed);
+    stats.bounces = bounces.load(std::memory_order_relaxed);
+    stats.dropped = dropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void TouchInput::flush()
+{
+    TouchEvent event;
+    while (poll(event))
+    {
+    }
+}
+
+// ============================================================================
+// INTERRUPT AND SAMPLING TASK
+// ============================================================================
+
+// The edge only hands over to the task; reading the controller takes ~100 us
+// of bit-banging, far too long for an interrupt handler. It is disarmed until
+// the press is over so contact bounce doesn't queue more wakeups.
+void IRAM_ATTR TouchInput::onIrq()
+{
+    TouchInput *touch = activeTouch;
+    if (!touch || !touch->armed)
+        return;
+    touch->armed = false;
+    touch->lastIrqUs = micros();
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(touch->task, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+void TouchInput::taskEntry(void *param)
+{
+    ((TouchInput *)param)->run();
+}
+
+void TouchInput::run()
+{
+    for (;;)
+    {
+        armed = true;
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        interrupts.fetch_add(1, std::memory_order_relaxed);
+        uint32_t irqUs = lastIrqUs;
+
+        vTaskDelay(pdMS_TO_TICKS(TOUCH_DEBOUNCE_MS));
+        uint16_t x, y, z;
+        if (!read(x, y, z))
+        {
+            bounces.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        presses.fetch_add(1, std::memory_order_relaxed);
+        push(TOUCH_DOWN, x, y, z, irqUs);
+
+        // Follow the press until it has been up for a few samples; UP
+        // reports the last position that was still pressed
+        int released = 0;
+        while (released < TOUCH_RELEASE_SAMPLES)
+        {
+            vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+            uint16_t nx, ny, nz;
+            if (read(nx, ny, nz))
+            {
+                x = nx;
+                y = ny;
+                z = nz;
+                released = 0;
+            }
+            else
+            {
+                released++;
+            }
+        }
+        push(TOUCH_UP, x, y, z, irqUs);
+    }
+}
+
+// ============================================================================
+// CONTROLLER ACCESS
+// ============================================================================
+
+// One 24-clock conversion: 8 command bits out, then 16 bits in holding a
+// busy bit, the 12-bit result and 3 trailing zeros. The controller shifts
+// on the falling edge, so each bit is sampled while the clock is high.
+uint16_t TouchInput::transfer(uint8_t command)
+{
+    for (int bit = 7; bit >= 0; bit--)
+    {
+        digitalWrite(pins.mosi, (command >> bit) & 1);
+        digitalWrite(pins.clk, HIGH);
+        digitalWrite(pins.clk, LOW);
+    }
+    digitalWrite(pins.mosi, LOW);
+
+    uint16_t value = 0;
+    for (int bit = 0; bit < 16; bit++)
+    {
+        digitalWrite(pins.clk, HIGH);
+        value = (value << 1) | (digitalRead(pins.miso) ? 1 : 0);
+        digitalWrite(pins.clk, LOW);
+    }
+    return value >> 3;
+}
+
+static uint16_t median3(uint16_t a, uint16_t b, uint16_t c)
+{
+    if (a > b)
+    {
+        uint16_t t = a;
+        a = b;
+        b = t;
+    }
+    if (b > c)
+        b = c;
+    return a > b ? a : b;
+}
+
+// Pressure first, so a released panel costs two conversions; position is
+// the median of three to drop single-sample spikes
+bool TouchInput::read(uint16_t &x, uint16_t &y, uint16_t &z)
+{
+    digitalWrite(pins.cs, LOW);
+    uint16_t z1 = transfer(XPT_READ_Z1);
+    uint16_t z2 = transfer(XPT_READ_Z2);
+    int pressure = z1 + 4095 - z2;
+    if (pressure < TOUCH_Z_THRESHOLD)
+    {
+        digitalWrite(pins.cs, HIGH);
+        return false;
+    }
+
+    uint16_t xs[3], ys[3];
+    for (int i = 0; i < 3; i++)
+    {
+        xs[i] = transfer(XPT_READ_X);
+        ys[i] = transfer(XPT_READ_Y);
+    }
+    digitalWrite(pins.cs, HIGH);
+
+    x = median3(xs[0], xs[1], xs[2]);
+    y = median3(ys[0], ys[1], ys[2]);
+    z = pressure > 4095 ? 4095 : pressure;
+    return true;
+}
+
+// Calibration gives the position in rotation 0; TFT_eSPI's other rotations
+// turn the screen in 90 degree steps clockwise
+void TouchInput::push(uint8_t type, uint16_t rawX, uint16_t rawY, uint16_t z, uint32_t irqUs)
+{
+    const TouchCalibration &cal = calibration;
+    int32_t px = constrain(map(rawX, cal.minX, cal.maxX, 0, panelW - 1), 0, panelW - 1);
+    int32_t py = constrain(map(rawY, cal.minY, cal.maxY, 0, panelH - 1), 0, panelH - 1);
+
+    TouchEvent event;
+    event.type = type;
+    switch (rotation)
+    {
+    case 1:
+        event.x = py;
+        event.y = panelW - 1 - px;
+        break;
+    case 2:
+        event.x = panelW - 1 - px;
+        event.y = panelH - 1 - py;
+        break;
+    case 3:
+        event.x = panelH - 1 - py;
+        event.y = px;
+        break;
+    default:
+        event.x = px;
+        event.y = py;
+        break;
+    }
+    event.rawX = rawX;
+    event.rawY = rawY;
+    event.z = z;
+    event.irqUs = irqUs;
+
+    if (!queue.push(event))
+        dropped.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,122 @@
+/*
+ * Interrupt-driven XPT2046 touch input with a lock-free event queue
+ *
+ * The controller pulls PENIRQ low while the panel is pressed. That edge
+ * only wakes a sampling task on core 0: the task debounces the press,
+ * reads the controller, maps the reading through the calibration and
+ * pushes DOWN/UP events into a single-producer/single-consumer queue. The
+ * render loop drains it with poll(), which costs one atomic load when
+ * nothing happened, instead of polling the controller every frame.
+ *
+ * The controller is read over its own bit-banged pins. On the CYD the
+ * touch pins are not the SD card's VSPI pins, and a task on the other core
+ * can't borrow that bus mid-transfer.
+ */
+
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <Arduino.h>
+#include <SpscRing.h>
+#include <atomic>
+
+// Pressure (Z1 + 4095 - Z2) that counts as a press
+#define TOUCH_Z_THRESHOLD 400
+
+// Settle time after PENIRQ before the first reading
+#define TOUCH_DEBOUNCE_MS 5
+
+// Sampling period while pressed; this many low readings end the press
+#define TOUCH_SAMPLE_MS 10
+#define TOUCH_RELEASE_SAMPLES 2
+
+struct TouchPins
+{
+    uint8_t clk, mosi, miso, cs, irq;
+};
+
+// Raw readings at the left/right and top/bottom edges in rotation 0
+// (TOUCH_MIN_X..TOUCH_MAX_Y in CYD_Config.h). Min may exceed max.
+struct TouchCalibration
+{
+    uint16_t minX, maxX, minY, maxY;
+};
+
+enum TouchEventType : uint8_t
+{
+    TOUCH_DOWN,
+    TOUCH_UP
+};
+
+struct TouchEvent
+{
+    uint8_t type;
+    int16_t x, y;             // screen position in the current rotation
+    uint16_t rawX, rawY, z;   // controller readings
+    uint32_t irqUs;           // micros() when PENIRQ fell
+};
+
+struct TouchStats
+{
+    uint32_t interrupts;
+    uint32_t presses;
+    uint32_t bounces; // PENIRQ edges with no press after the debounce
+    uint32_t dropped; // events lost to a full queue
+};
+
+class TouchInput
+{
+public:
+    static const uint32_t QUEUE_SIZE = 16;
+
+    // width x height is the panel in rotation 0. Starts the sampling task
+    // on core 0; only one TouchInput can be active.
+    bool begin(const TouchPins &pins, const TouchCalibration &cal, int16_t width, int16_t height);
+
+    void setCalibration(const TouchCalibration &cal) { calibration = cal; }
+    const TouchCalibration &getCalibration() const { return calibration; }
+
+    // Report positions for a TFT_eSPI rotation (0-3)
+    void setRotation(uint8_t r) { rotation = r & 3; }
+
+    // Render loop side: next event, or false if none is queued
+    bool poll(TouchEvent &event) { return queue.pop(event); }
+
+    // Waits up to timeoutMs for a complete tap and returns its DOWN event;
+    // a timeoutMs of 0 waits forever
+    bool waitForTap(TouchEvent &down, uint32_t timeoutMs);
+
+    // Discards queued events
+    void flush();
+
+    // Safe from the render loop while the task runs; each counter is read
+    // atomically, though the four aren't one snapshot
+    TouchStats getStats() const;
+
+private:
+    static void onIrq();
+    static void taskEntry(void *param);
+    void run();
+
+    uint16_t transfer(uint8_t command);
+    bool read(uint16_t &x, uint16_t &y, uint16_t &z);
+    void push(uint8_t type, uint16_t rawX, uint16_t rawY, uint16_t z, uint32_t irqUs);
+
+    TouchPins pins;
+    TouchCalibration calibration;
+    int16_t panelW = 240, panelH = 320;
+    uint8_t rotation = 0;
+
+    SpscRing<TouchEvent, QUEUE_SIZE> queue;
+    TaskHandle_t task = nullptr;
+    volatile bool armed = false;
+    volatile uint32_t lastIrqUs = 0;
+
+    // Written by the sampling task, read through getStats()
+    std::atomic<uint32_t> interrupts{0};
+    std::atomic<uint32_t> presses{0};
+    std::atomic<uint32_t> bounces{0};
+    std::atomic<uint32_t> dropped{0};
+};
+
+#endif // TOUCH_INPUT_H
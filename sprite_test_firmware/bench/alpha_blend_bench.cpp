@@ -0,0 +1,201 @@
+/*
+ * Host microbenchmark for the alpha blend kernels (src/AlphaBlend.cpp)
+ *
+ * The packed 0x07E0F81F blend is checked bit for bit against a per-channel
+ * reference (unpack, weight each channel, repack) over every alpha and
+ * random colour pairs, and its error against exact rounding is reported.
+ * The row kernels are then timed against the reference in Mpixels/s, on
+ * alpha that is partial everywhere and on a sprite-like mix where most
+ * pixels are fully transparent or fully opaque.
+ *
+ *   pio run -e bench-alpha-blend && .pio/build/bench-alpha-blend/program
+ *
+ * Exits non-zero if any output differs from the reference.
+ */
+
+#include "AlphaSprite.h"
+
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define ROW_WIDTH 240
+#define ROWS 240
+#define REPEATS 50
+#define COLOUR_PAIRS 200000
+
+// ============================================================================
+// REFERENCE
+// ============================================================================
+
+// Same weighting as the kernel, one channel at a time: bg + (fg - bg) * a / 32,
+// rounded down
+static uint16_t referenceBlend(uint16_t fg, uint16_t bg, int alpha)
+{
+    int fr = fg >> 11, fgr = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+    int br = bg >> 11, bgr = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+    int r = br + (int)floor((fr - br) * alpha / 32.0);
+    int g = bgr + (int)floor((fgr - bgr) * alpha / 32.0);
+    int b = bb + (int)floor((fb - bb) * alpha / 32.0);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// Largest channel difference from the exactly rounded blend
+static int roundingError(uint16_t fg, uint16_t bg, int alpha, uint16_t got)
+{
+    static const int shifts[3] = {11, 5, 0};
+    static const int masks[3] = {0x1F, 0x3F, 0x1F};
+    int worst = 0;
+    for (int c = 0; c < 3; c++)
+    {
+        int f = (fg >> shifts[c]) & masks[c];
+        int b = (bg >> shifts[c]) & masks[c];
+        int exact = (f * alpha + b * (32 - alpha) + 16) / 32;
+        int err = abs(((got >> shifts[c]) & masks[c]) - exact);
+        if (err > worst)
+            worst = err;
+    }
+    return worst;
+}
+
+static void referenceRow8(uint16_t *dest, const uint16_t *src, const uint8_t *alpha8, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        int a = (alpha8[i] + 4) >> 3;
+        dest[i] = referenceBlend(src[i], dest[i], a);
+    }
+}
+
+static void referenceRow4(uint16_t *dest, const uint16_t *src, const uint8_t *alpha4, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        int a4 = (alpha4[i >> 1] >> ((i & 1) * 4)) & 0x0F;
+        dest[i] = referenceBlend(src[i], dest[i], (a4 * 32 + 7) / 15);
+    }
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    std::mt19937 rng(0xA1FA);
+    int failures = 0;
+
+    // Every alpha against random colours, plus the extremes
+    int wrong = 0, worstError = 0;
+    for (int i = 0; i < COLOUR_PAIRS; i++)
+    {
+        uint16_t fg = i < 2 ? 0xFFFF * i : rng();
+        uint16_t bg = i < 2 ? 0xFFFF * (1 - i) : rng();
+        for (int a = 0; a <= 32; a++)
+        {
+            uint16_t got = alphaBlend565(fg, bg, a);
+            if (got != referenceBlend(fg, bg, a))
+                wrong++;
+            int err = roundingError(fg, bg, a, got);
+            if (err > worstError)
+                worstError = err;
+        }
+    }
+    failures += wrong;
+    printf("alphaBlend565: %s over %d blends, at most %d LSB from exact rounding\n",
+           wrong ? "MISMATCH" : "exact", COLOUR_PAIRS * 33, worstError);
+
+    std::vector<uint16_t> sprite((size_t)ROW_WIDTH * ROWS), background((size_t)ROW_WIDTH * ROWS);
+    for (size_t i = 0; i < sprite.size(); i++)
+    {
+        sprite[i] = rng();
+        background[i] = rng();
+    }
+
+    // Partial alpha everywhere, then a sprite: a third transparent, half
+    // opaque, the rest edge pixels
+    struct AlphaCase
+    {
+        const char *name;
+        int bits;
+        bool spriteLike;
+    };
+    static const AlphaCase cases[] = {
+        {"8-bit partial", 8, false},
+        {"8-bit sprite", 8, true},
+        {"4-bit partial", 4, false},
+        {"4-bit sprite", 4, true},
+    };
+
+    printf("%-14s %12s %12s %8s  %s\n", "alpha", "ref Mpix/s", "fast Mpix/s", "speedup", "result");
+    for (const AlphaCase &c : cases)
+    {
+        int pitch = c.bits == 8 ? ROW_WIDTH : ROW_WIDTH / 2;
+        std::vector<uint8_t> alpha((size_t)pitch * ROWS);
+        for (int i = 0; i < ROW_WIDTH * ROWS; i++)
+        {
+            int r = rng() % 6;
+            int a8 = !c.spriteLike ? (int)(rng() % 256) : r < 2 ? 0 : r < 5 ? 255 : (int)(rng() % 256);
+            if (c.bits == 8)
+                alpha[i] = a8;
+            else
+                alpha[i >> 1] |= ((a8 * 15 + 127) / 255) << ((i & 1) * 4);
+        }
+
+        std::vector<uint16_t> ref(background), fast(background);
+
+        // Blending is repeated over the same destination, so the results
+        // drift the same way in both
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < REPEATS; rep++)
+        {
+            for (int y = 0; y < ROWS; y++)
+            {
+                uint16_t *dest = &ref[(size_t)y * ROW_WIDTH];
+                const uint16_t *src = &sprite[(size_t)y * ROW_WIDTH];
+                if (c.bits == 8)
+                    referenceRow8(dest, src, &alpha[(size_t)y * pitch], ROW_WIDTH);
+                else
+                    referenceRow4(dest, src, &alpha[(size_t)y * pitch], ROW_WIDTH);
+            }
+        }
+        double refSeconds = secondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < REPEATS; rep++)
+        {
+            for (int y = 0; y < ROWS; y++)
+            {
+                uint16_t *dest = &fast[(size_t)y * ROW_WIDTH];
+                const uint16_t *src = &sprite[(size_t)y * ROW_WIDTH];
+                if (c.bits == 8)
+                    alphaBlendRow8(dest, src, &alpha[(size_t)y * pitch], ROW_WIDTH);
+                else
+                    alphaBlendRow4(dest, src, &alpha[(size_t)y * pitch], 0, ROW_WIDTH);
+            }
+        }
+        double fastSeconds = secondsSince(start);
+
+        int rowWrong = 0;
+        for (size_t i = 0; i < ref.size(); i++)
+            if (ref[i] != fast[i])
+                rowWrong++;
+        failures += rowWrong;
+
+        double mpixels = (double)ROW_WIDTH * ROWS * REPEATS / 1e6;
+        printf("%-14s %12.1f %12.1f %7.1fx  %s\n", c.name, mpixels / refSeconds, mpixels / fastSeconds,
+               refSeconds / fastSeconds, rowWrong ? "MISMATCH" : "bit-exact");
+        if (rowWrong)
+            printf("  %d of %zu pixels differ\n", rowWrong, ref.size());
+    }
+
+    return failures ? 1 : 0;
+}
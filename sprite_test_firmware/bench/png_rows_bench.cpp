@@ -0,0 +1,174 @@
+/*
+ * Host microbenchmark for the PNG row converters (src/PngRows.cpp)
+ *
+ * Every converter is checked bit for bit against a straightforward
+ * per-pixel reference (format switch per pixel, divide by 255) on random
+ * rows that cover every alpha value, then both are timed.
+ *
+ *   pio run -e bench-png-rows && .pio/build/bench-png-rows/program
+ *
+ * Exits non-zero if any output differs from the reference.
+ */
+
+#include "PngRows.h"
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#define ROW_WIDTH 240
+#define ROWS 240
+#define REPEATS 50
+
+struct Format
+{
+    const char *name;
+    int pixelType;
+    int bitDepth;
+    int channels;
+    bool hasAlpha;
+};
+
+static const Format formats[] = {
+    {"RGBA8888", 6, 8, 4, false},
+    {"RGB888", 2, 8, 3, false},
+    {"Indexed8+tRNS", 3, 8, 1, true},
+    {"Indexed8", 3, 8, 1, false},
+    {"Indexed4", 3, 4, 1, false},
+    {"Indexed2", 3, 2, 1, false},
+    {"Indexed1", 3, 1, 1, false},
+    {"Gray8", 0, 8, 1, false},
+    {"Gray4", 0, 4, 1, false},
+    {"GrayAlpha88", 4, 8, 2, false},
+};
+
+// ============================================================================
+// REFERENCE
+// ============================================================================
+
+static int sampleAt(const uint8_t *row, int x, int bitDepth)
+{
+    if (bitDepth == 8)
+        return row[x];
+    int perByte = 8 / bitDepth;
+    int shift = 8 - bitDepth * (x % perByte + 1);
+    return (row[x / perByte] >> shift) & ((1 << bitDepth) - 1);
+}
+
+static void referenceRow(const Format &f, const uint8_t *row, const uint8_t *palette, uint16_t *dst)
+{
+    for (int x = 0; x < ROW_WIDTH; x++)
+    {
+        int r = 0, g = 0, b = 0, a = 255;
+        switch (f.pixelType)
+        {
+        case 6:
+            r = row[x * 4]; g = row[x * 4 + 1]; b = row[x * 4 + 2]; a = row[x * 4 + 3];
+            break;
+        case 2:
+            r = row[x * 3]; g = row[x * 3 + 1]; b = row[x * 3 + 2];
+            break;
+        case 3:
+        {
+            int i = sampleAt(row, x, f.bitDepth);
+            r = palette[i * 3]; g = palette[i * 3 + 1]; b = palette[i * 3 + 2];
+            if (f.hasAlpha)
+                a = palette[768 + i];
+            break;
+        }
+        case 4:
+            r = g = b = row[x * 2]; a = row[x * 2 + 1];
+            break;
+        default:
+            r = g = b = sampleAt(row, x, f.bitDepth) * 255 / ((1 << f.bitDepth) - 1);
+            break;
+        }
+        if (a < 255)
+        {
+            r = r * a / 255;
+            g = g * a / 255;
+            b = b * a / 255;
+        }
+        dst[x] = ((b >> 3) << 11) | ((g >> 2) << 5) | (r >> 3);
+    }
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    std::mt19937 rng(0xC0FFEE);
+    int failures = 0;
+
+    // multiply-shift vs division over the whole 8-bit domain
+    for (int x = 0; x < 256; x++)
+        for (int a = 0; a < 256; a++)
+            if (pngMulDiv255(x, a) != x * a / 255)
+                failures++;
+    printf("pngMulDiv255: %s over 65536 inputs\n", failures ? "MISMATCH" : "exact");
+
+    uint8_t palette[1024];
+    for (int i = 0; i < 1024; i++)
+        palette[i] = rng();
+
+    printf("%-14s %10s %10s %8s  %s\n", "format", "ref ns/px", "fast ns/px", "speedup", "result");
+    for (const Format &f : formats)
+    {
+        int pitch = (ROW_WIDTH * f.channels * f.bitDepth + 7) / 8;
+        std::vector<uint8_t> image((size_t)pitch * ROWS);
+        for (size_t i = 0; i < image.size(); i++)
+            image[i] = rng();
+
+        // Make sure every alpha value, including 0 and 255, shows up
+        if (f.pixelType == 6 || f.pixelType == 4)
+        {
+            int step = f.channels;
+            for (int i = 0; i < ROW_WIDTH * ROWS; i++)
+                image[i * step + step - 1] = (uint8_t)i;
+        }
+
+        std::vector<uint16_t> ref((size_t)ROW_WIDTH * ROWS), fast((size_t)ROW_WIDTH * ROWS);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < REPEATS; rep++)
+            for (int y = 0; y < ROWS; y++)
+                referenceRow(f, &image[(size_t)y * pitch], palette, &ref[(size_t)y * ROW_WIDTH]);
+        double refSeconds = secondsSince(start);
+
+        uint16_t table[256];
+        PngRowConverter convert = pngRowConverter(f.pixelType, f.bitDepth);
+        start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < REPEATS; rep++)
+        {
+            // The table is built once per image, so it is part of the cost
+            pngBuildRowTable(f.pixelType, f.bitDepth, palette, f.hasAlpha, table);
+            for (int y = 0; y < ROWS; y++)
+                convert(&image[(size_t)y * pitch], &fast[(size_t)y * ROW_WIDTH], ROW_WIDTH, table);
+        }
+        double fastSeconds = secondsSince(start);
+
+        int wrong = 0;
+        for (size_t i = 0; i < ref.size(); i++)
+            if (ref[i] != fast[i])
+                wrong++;
+        failures += wrong;
+
+        double pixels = (double)ROW_WIDTH * ROWS * REPEATS;
+        printf("%-14s %10.2f %10.2f %7.1fx  %s\n", f.name,
+               refSeconds * 1e9 / pixels, fastSeconds * 1e9 / pixels,
+               refSeconds / fastSeconds, wrong ? "MISMATCH" : "bit-exact");
+        if (wrong)
+            printf("  %d of %zu pixels differ\n", wrong, ref.size());
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,307 @@
+/*
+ * Host stand-in for the Arduino-ESP32 core
+ */
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+#include <stdarg.h>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// ============================================================================
+// TIMING, GPIO AND MATH
+// ============================================================================
+
+unsigned long millis()
+{
+    return (unsigned long)(hostSimNowUs() / 1000.0);
+}
+
+unsigned long micros()
+{
+    return (unsigned long)hostSimNowUs();
+}
+
+void delay(uint32_t ms)
+{
+    hostSimAdvanceBy(ms * 1000.0);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    hostSimAdvanceBy(us);
+}
+
+// Lets another task run, as vPortYield() does on the board
+void yield()
+{
+    std::this_thread::yield();
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    hostSimGpioWrite(pin, val);
+}
+
+int digitalRead(uint8_t pin)
+{
+    return hostSimGpioRead(pin);
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode)
+{
+    hostSimAttachInterrupt(pin, handler, mode);
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    hostSimDetachInterrupt(pin);
+}
+
+// Deterministic so host runs (and their rendered frames) are reproducible;
+// the board uses the hardware RNG until randomSeed() is called
+static uint32_t randomState = 0x2545F491;
+
+static uint32_t nextRandom()
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+long random(long howbig)
+{
+    if (howbig <= 0)
+        return 0;
+    return nextRandom() % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+    if (howsmall >= howbig)
+        return howsmall;
+    return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed)
+{
+    if (seed != 0)
+        randomState = (uint32_t)seed;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+    long divisor = in_max - in_min;
+    if (divisor == 0)
+        return -1;
+    return (x - in_min) * (out_max - out_min) / divisor + out_min;
+}
+
+// ============================================================================
+// STRING
+// ============================================================================
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base)
+{
+    char buf[72];
+    char *p = buf + sizeof(buf) - 1;
+    *p = '\0';
+    if (base < 2)
+        base = 10;
+    do
+    {
+        unsigned digit = value % base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        value /= base;
+    } while (value);
+    if (negative)
+        *--p = '-';
+    return std::string(p);
+}
+
+static std::string formatFloat(double value, unsigned int decimals)
+{
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+    return std::string(buf);
+}
+
+String::String(const char *s) : text(s ? s : "") {}
+String::String(char c) : text(1, c) {}
+String::String(int value, unsigned char base)
+    : text(base == DEC ? formatInteger(value < 0 ? -(long long)value : value, value < 0, base) : formatInteger((unsigned int)value, false, base)) {}
+String::String(unsigned int value, unsigned char base) : text(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base)
+    : text(base == DEC ? formatInteger(value < 0 ? -(long long)value : value, value < 0, base) : formatInteger((unsigned long)value, false, base)) {}
+String::String(unsigned long value, unsigned char base) : text(formatInteger(value, false, base)) {}
+String::String(float value, unsigned int decimals) : text(formatFloat(value, decimals)) {}
+String::String(double value, unsigned int decimals) : text(formatFloat(value, decimals)) {}
+
+String &String::operator+=(const String &other)
+{
+    text += other.text;
+    return *this;
+}
+
+String operator+(const String &lhs, const String &rhs)
+{
+    String result(lhs);
+    result += rhs;
+    return result;
+}
+
+// ============================================================================
+// PRINT
+// ============================================================================
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+        n += write(*buffer++);
+    return n;
+}
+
+size_t Print::print(const char *s)
+{
+    return s ? write((const uint8_t *)s, strlen(s)) : 0;
+}
+
+size_t Print::print(const String &s)
+{
+    return print(s.c_str());
+}
+
+size_t Print::print(char c)
+{
+    return write((uint8_t)c);
+}
+
+size_t Print::printNumber(unsigned long long value, int base)
+{
+    return print(formatInteger(value, false, (unsigned char)base).c_str());
+}
+
+size_t Print::print(unsigned char value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::print(int value, int base)
+{
+    return print((long long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::print(long value, int base)
+{
+    return print((long long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::print(long long value, int base)
+{
+    if (base == DEC && value < 0)
+        return print(formatInteger(-(unsigned long long)value, true, DEC).c_str());
+    return printNumber((unsigned long long)value, base);
+}
+
+size_t Print::print(unsigned long long value, int base)
+{
+    return printNumber(value, base);
+}
+
+size_t Print::print(double value, int digits)
+{
+    return print(formatFloat(value, digits).c_str());
+}
+
+size_t Print::println()
+{
+    return print("\r\n");
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char small[128];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (len < 0)
+        return 0;
+    if ((size_t)len < sizeof(small))
+        return write((const uint8_t *)small, len);
+
+    std::string big(len + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&big[0], big.size(), format, args);
+    va_end(args);
+    return write((const uint8_t *)big.data(), len);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (c != '\r')
+        fputc(c, stdout);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+        write(buffer[i]);
+    return size;
+}
+
+void HardwareSerial::flush()
+{
+    fflush(stdout);
+}
+
+// ============================================================================
+// ESP CLASS
+// ============================================================================
+
+uint32_t EspClass::getHeapSize()
+{
+    return HOST_HEAP_BYTES;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    return hostSimFreeHeap();
+}
+
+uint32_t EspClass::getMinFreeHeap()
+{
+    return hostSimMinFreeHeap();
+}
+
+uint32_t EspClass::getMaxAllocHeap()
+{
+    return hostSimMaxAllocHeap();
+}
+
+uint32_t EspClass::getCycleCount()
+{
+    return (uint32_t)(hostSimNowUs() * getCpuFreqMHz());
+}
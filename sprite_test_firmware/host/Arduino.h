@@ -0,0 +1,188 @@
+/*
+ * Host stand-in for the Arduino-ESP32 core
+ *
+ * Only the subset used by the sprite test firmware is provided. Time is
+ * virtual: millis()/micros() return host CPU time plus every modeled wait
+ * (SPI wire time, SD access, delay()), see HostSim.h.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+// Included by the ESP32 core's Arduino.h as well
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// ============================================================================
+// BASIC TYPES AND CONSTANTS
+// ============================================================================
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+using std::max;
+using std::min;
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+// ============================================================================
+// TIMING, GPIO AND MATH
+// ============================================================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// ============================================================================
+// STRING AND PRINT
+// ============================================================================
+
+class String
+{
+public:
+    String(const char *s = "");
+    String(const String &other) = default;
+    String(char c);
+    String(int value, unsigned char base = DEC);
+    String(unsigned int value, unsigned char base = DEC);
+    String(long value, unsigned char base = DEC);
+    String(unsigned long value, unsigned char base = DEC);
+    String(float value, unsigned int decimals = 2);
+    String(double value, unsigned int decimals = 2);
+
+    String &operator=(const String &other) = default;
+    String &operator+=(const String &other);
+    friend String operator+(const String &lhs, const String &rhs);
+    bool operator==(const String &other) const { return text == other.text; }
+    bool operator!=(const String &other) const { return text != other.text; }
+
+    const char *c_str() const { return text.c_str(); }
+    unsigned int length() const { return (unsigned int)text.size(); }
+
+private:
+    std::string text;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+
+    size_t print(const char *s);
+    size_t print(const String &s);
+    size_t print(char c);
+    size_t print(unsigned char value, int base = DEC);
+    size_t print(int value, int base = DEC);
+    size_t print(unsigned int value, int base = DEC);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(long long value, int base = DEC);
+    size_t print(unsigned long long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template <typename T>
+    size_t println(const T &value)
+    {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(const T &value, int format)
+    {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+    size_t printNumber(unsigned long long value, int base);
+};
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    void flush();
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// ============================================================================
+// ESP CLASS
+// ============================================================================
+
+class EspClass
+{
+public:
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getPsramSize() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getCycleCount();
+    const char *getChipModel() { return "ESP32-D0WD-V3 (host)"; }
+    void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,156 @@
+/*
+ * Host stand-in for FreeRTOS tasks, on std::thread
+ */
+
+#include "freertos/task.h"
+#include "HostSim.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+
+struct HostTask
+{
+    std::mutex lock;
+    std::condition_variable wake;
+    uint32_t notifications = 0;
+    bool blocked = false;
+};
+
+// Thrown by vTaskDelete(NULL) to unwind back to the thread entry
+struct HostTaskExit
+{
+};
+
+static thread_local BaseType_t currentCore = 1;
+static thread_local HostTask *currentTask = nullptr;
+
+// The Arduino loop task and anything else not started here
+static HostTask *selfTask()
+{
+    static thread_local HostTask implicitTask;
+    return currentTask ? currentTask : &implicitTask;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *createdTask,
+                                   BaseType_t coreId)
+{
+    (void)stackDepth;
+    (void)priority;
+
+    // Never freed: a handle may outlive its task, as with a deleted task's
+    // handle on the ESP32
+    HostTask *task = new HostTask();
+
+    // Real-time mode starts before the task can touch the clock
+    hostSimTaskStarted();
+    std::thread([=]()
+                {
+                    currentCore = coreId;
+                    currentTask = task;
+                    try
+                    {
+                        function(parameter);
+                        fprintf(stderr, "[host] task '%s' returned without vTaskDelete(NULL)\n", name);
+                    }
+                    catch (const HostTaskExit &)
+                    {
+                    }
+                    hostSimTaskEnded(); })
+        .detach();
+
+    if (createdTask)
+        *createdTask = task;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task != nullptr)
+    {
+        fprintf(stderr, "[host] vTaskDelete() of another task is not supported\n");
+        return;
+    }
+    throw HostTaskExit();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    hostSimAdvanceBy(ticks * portTICK_PERIOD_MS * 1000.0);
+}
+
+BaseType_t xPortGetCoreID()
+{
+    return currentCore;
+}
+
+void hostTaskYield()
+{
+    std::this_thread::yield();
+}
+
+// ============================================================================
+// NOTIFICATIONS
+// ============================================================================
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+    HostTask *task = selfTask();
+
+    // Timed waits poll the virtual clock a tick at a time. The clock is read
+    // without the task lock: an interrupt handler run by hostSimNowUs() may
+    // be notifying this task.
+    if (ticksToWait > 0 && ticksToWait != portMAX_DELAY)
+    {
+        double deadlineUs = hostSimNowUs() + ticksToWait * portTICK_PERIOD_MS * 1000.0;
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> guard(task->lock);
+                if (task->notifications > 0)
+                    break;
+            }
+            if (hostSimNowUs() >= deadlineUs)
+                break;
+            vTaskDelay(1);
+        }
+    }
+
+    std::unique_lock<std::mutex> guard(task->lock);
+    if (task->notifications == 0 && ticksToWait == portMAX_DELAY)
+    {
+        task->blocked = true;
+        hostSimTaskEnded();
+        task->wake.wait(guard, [task]()
+                        { return !task->blocked; });
+    }
+
+    uint32_t count = task->notifications;
+    if (count > 0)
+        task->notifications = clearCountOnExit ? 0 : count - 1;
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (!task)
+        return pdFAIL;
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notifications++;
+    if (task->blocked)
+    {
+        task->blocked = false;
+        hostSimTaskStarted();
+        task->wake.notify_one();
+    }
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdTRUE;
+}
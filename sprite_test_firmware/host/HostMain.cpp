@@ -0,0 +1,91 @@
+/*
+ * Host entry point for the native build
+ *
+ * Runs the firmware's setup() and then loop() until the suite reports
+ * completion. Each loop() call runs one test, so the CPU/bus split printed
+ * after it is that test's cost. Set CYD_FRAME_DIR to also dump the panel
+ * after every test as test_NN.ppm.
+ *
+ * Left out of `pio test` builds, whose test programs bring their own main().
+ */
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+#ifndef PIO_UNIT_TESTING
+
+void setup();
+void loop();
+extern bool testsComplete;
+
+struct HostSnapshot
+{
+    double virtualUs;
+    double cpuUs;
+    HostBusStats bus;
+    HostBusStats sd;
+};
+
+static HostSnapshot snapshot()
+{
+    HostSnapshot s;
+    s.virtualUs = hostSimNowUs();
+    s.cpuUs = hostSimCpuUs();
+    s.bus = hostSimBusStats();
+    s.sd = hostSimSdStats();
+    return s;
+}
+
+static void printDelta(const char *label, const HostSnapshot &a, const HostSnapshot &b)
+{
+    Serial.flush();
+    printf("[host] %-8s virtual %10.0f us | cpu %9.0f us | tft %6llu xfers %9llu bytes %10.0f us | sd %9.0f us\n",
+           label,
+           b.virtualUs - a.virtualUs,
+           b.cpuUs - a.cpuUs,
+           (unsigned long long)(b.bus.transactions - a.bus.transactions),
+           (unsigned long long)(b.bus.bytes - a.bus.bytes),
+           b.bus.wireUs - a.bus.wireUs,
+           b.sd.wireUs - a.sd.wireUs);
+    fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    const char *frameDir = getenv("CYD_FRAME_DIR");
+
+    printf("[host] SPI %lu Hz requested, %lu Hz on the wire, SD root '%s'\n",
+           (unsigned long)SPI_FREQUENCY, (unsigned long)hostSimEffectiveHz(SPI_FREQUENCY), hostSimSdRoot());
+
+    HostSnapshot start = snapshot();
+    setup();
+    HostSnapshot before = snapshot();
+    printDelta("setup", start, before);
+
+    int test = 0;
+    while (!testsComplete)
+    {
+        loop();
+        HostSnapshot after = snapshot();
+
+        char label[16];
+        snprintf(label, sizeof(label), "test %02d", test);
+        printDelta(label, before, after);
+
+        if (frameDir)
+        {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/test_%02d.ppm", frameDir, test);
+            hostSimDumpPPM(path);
+        }
+        before = after;
+        test++;
+    }
+
+    printDelta("total", start, snapshot());
+    return 0;
+}
+
+#endif // PIO_UNIT_TESTING
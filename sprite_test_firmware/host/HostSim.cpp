@@ -0,0 +1,705 @@
+/*
+ * Host simulator: virtual clock, SPI bus models, touch controller, heap
+ * model and panel GRAM
+ */
+
+#include "HostSim.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ============================================================================
+// VIRTUAL CLOCK
+// ============================================================================
+
+static std::recursive_mutex simLock;
+static const std::chrono::steady_clock::time_point simStart = std::chrono::steady_clock::now();
+static double simOffsetUs = 0.0;
+static std::atomic<int> realtimeTasks(0);
+
+static double cpuScale()
+{
+    static double scale = -1.0;
+    if (scale < 0.0)
+    {
+        const char *env = getenv("CYD_HOST_CPU_SCALE");
+        scale = env ? atof(env) : 1.0;
+        if (scale <= 0.0)
+            scale = 1.0;
+    }
+    return scale;
+}
+
+double hostSimCpuUs()
+{
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - simStart;
+    return elapsed.count() * cpuScale();
+}
+
+static double nextInputEdgeUs();
+static void serviceInputs(double now);
+
+double hostSimNowUs()
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    double now = hostSimCpuUs() + simOffsetUs;
+    if (now >= nextInputEdgeUs())
+        serviceInputs(now);
+    return now;
+}
+
+// Real-time mode: sleep until the clock gets there. The last stretch is
+// yielded rather than slept so short waits are not stretched by the
+// scheduler's wakeup latency, and no sleep runs past a touch edge.
+static void waitUntil(double us)
+{
+    for (;;)
+    {
+        double now = hostSimNowUs();
+        if (us <= now)
+            return;
+        double remaining = (std::min(us, nextInputEdgeUs()) - now) / cpuScale();
+        if (remaining > HOST_REALTIME_SPIN_US)
+            std::this_thread::sleep_for(std::chrono::microseconds((long)(remaining - HOST_REALTIME_SPIN_US)));
+        else
+            std::this_thread::yield();
+    }
+}
+
+// Jumps stop at each touch edge so its interrupt fires on time; the handler
+// may wake a task, which switches the rest of the wait to real time
+void hostSimAdvanceTo(double us)
+{
+    for (;;)
+    {
+        if (realtimeTasks.load() > 0)
+        {
+            waitUntil(us);
+            return;
+        }
+        std::lock_guard<std::recursive_mutex> guard(simLock);
+        double now = hostSimNowUs();
+        if (us <= now)
+            return;
+        if (realtimeTasks.load() > 0)
+            continue;
+        double step = std::min(us, nextInputEdgeUs());
+        simOffsetUs += step - now;
+        if (step >= us)
+            return;
+    }
+}
+
+void hostSimAdvanceBy(double us)
+{
+    if (us <= 0.0)
+        return;
+    if (realtimeTasks.load() > 0)
+    {
+        waitUntil(hostSimNowUs() + us);
+        return;
+    }
+    double targetUs;
+    {
+        std::lock_guard<std::recursive_mutex> guard(simLock);
+        targetUs = hostSimNowUs() + us;
+        if (nextInputEdgeUs() > targetUs)
+        {
+            simOffsetUs += us;
+            return;
+        }
+    }
+    // Not under the lock: the wait may turn real-time
+    hostSimAdvanceTo(targetUs);
+}
+
+void hostSimTaskStarted()
+{
+    realtimeTasks++;
+}
+
+void hostSimTaskEnded()
+{
+    realtimeTasks--;
+}
+
+// ============================================================================
+// DISPLAY BUS (HSPI)
+// ============================================================================
+
+static uint32_t busHz = SPI_FREQUENCY;
+static double busFreeAtUs = 0.0;
+static HostBusStats busStats = {0, 0, 0.0};
+static bool busHeld = false;
+static bool busClaimed = false;
+
+uint32_t hostSimEffectiveHz(uint32_t requestedHz)
+{
+    if (requestedHz >= HOST_APB_CLOCK_HZ)
+        return HOST_APB_CLOCK_HZ;
+    if (requestedHz == 0)
+        return 1;
+    uint32_t divider = (HOST_APB_CLOCK_HZ + requestedHz - 1) / requestedHz;
+    return HOST_APB_CLOCK_HZ / divider;
+}
+
+void hostSimSetBusFrequency(uint32_t hz)
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    busHz = hz;
+}
+
+uint32_t hostSimBusFrequency()
+{
+    return busHz;
+}
+
+double hostSimBusTransfer(size_t bytes, bool async, uint32_t hz)
+{
+    std::unique_lock<std::recursive_mutex> guard(simLock);
+    double overheadUs = HOST_TFT_TRANSACTION_US;
+    if (!async && busHeld)
+    {
+        if (busClaimed)
+            overheadUs = 0.0;
+        busClaimed = true;
+    }
+    double wireUs = overheadUs + bytes * 8.0 * 1e6 / hostSimEffectiveHz(hz ? hz : busHz);
+    double now = hostSimNowUs();
+    double start = busFreeAtUs > now ? busFreeAtUs : now;
+    busFreeAtUs = start + wireUs;
+
+    busStats.transactions++;
+    busStats.bytes += bytes;
+    busStats.wireUs += wireUs;
+
+    // Waits happen outside the lock so another task's clock keeps running
+    double endUs = busFreeAtUs;
+    guard.unlock();
+    if (!async)
+        hostSimAdvanceTo(endUs);
+    return wireUs;
+}
+
+void hostSimBusHold(bool hold)
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    busHeld = hold;
+    busClaimed = false;
+}
+
+void hostSimBusWait()
+{
+    std::unique_lock<std::recursive_mutex> guard(simLock);
+    double endUs = busFreeAtUs;
+    guard.unlock();
+    hostSimAdvanceTo(endUs);
+}
+
+bool hostSimBusBusy()
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    return busFreeAtUs > hostSimNowUs();
+}
+
+double hostSimBusFreeAtUs()
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    return busFreeAtUs;
+}
+
+uint16_t hostSimBusCorrupt(uint16_t color)
+{
+    static long errorHz = -1;
+    static uint32_t pixels = 0;
+    if (errorHz < 0)
+    {
+        const char *env = getenv("CYD_SPI_ERROR_HZ");
+        errorHz = env ? atol(env) : 0;
+    }
+    if (errorHz == 0 || hostSimEffectiveHz(busHz) <= (uint32_t)errorHz)
+        return color;
+    if (++pixels % HOST_SPI_ERROR_INTERVAL)
+        return color;
+    return color ^ (1 << (pixels / HOST_SPI_ERROR_INTERVAL % 16));
+}
+
+HostBusStats hostSimBusStats()
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    return busStats;
+}
+
+void hostSimResetBusStats()
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    busStats = {0, 0, 0.0};
+}
+
+// ============================================================================
+// SD CARD BUS (VSPI)
+// ============================================================================
+
+static HostBusStats sdStats = {0, 0, 0.0};
+
+void hostSimSdOpen()
+{
+    {
+        std::lock_guard<std::recursive_mutex> guard(simLock);
+        sdStats.transactions++;
+        sdStats.wireUs += HOST_SD_OPEN_US;
+    }
+    hostSimAdvanceBy(HOST_SD_OPEN_US);
+}
+
+void hostSimSdTransfer(size_t bytes)
+{
+    if (bytes == 0)
+        return;
+    size_t sectors = (bytes + 511) / 512;
+    double us = bytes * 8.0 * 1e6 / HOST_SD_FREQUENCY + sectors * HOST_SD_SECTOR_US;
+    {
+        std::lock_guard<std::recursive_mutex> guard(simLock);
+        sdStats.bytes += bytes;
+        sdStats.wireUs += us;
+    }
+    hostSimAdvanceBy(us);
+}
+
+HostBusStats hostSimSdStats()
+{
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    return sdStats;
+}
+
+const char *hostSimSdRoot()
+{
+    const char *env = getenv("CYD_SD_ROOT");
+    return env ? env : "sd";
+}
+
+// ============================================================================
+// GPIO AND TOUCH CONTROLLER
+// ============================================================================
+
+struct HostTap
+{
+    double startUs, endUs;
+    int16_t x, y;
+};
+
+struct HostInterrupt
+{
+    void (*handler)();
+    int mode;
+};
+
+static uint8_t pinLevel[HOST_GPIO_COUNT];
+static HostInterrupt interrupts[HOST_GPIO_COUNT];
+static bool touchIrqLow = false;
+static bool servicingInputs = false;
+
+// XPT2046 shift state: rising clock edges since CS fell, the command being
+// shifted in and the conversion being shifted out
+static uint32_t touchClocks = 0;
+static uint8_t touchCommand = 0;
+static uint16_t touchOutput = 0;
+
+static const std::vector<HostTap> &scriptedTaps()
+{
+    static std::vector<HostTap> taps;
+    static bool parsed = false;
+    if (parsed)
+        return taps;
+    parsed = true;
+
+    const char *env = getenv("CYD_TOUCH_TAPS");
+    for (const char *p = env; p && *p;)
+    {
+        double startMs = 0.0, holdMs = HOST_TOUCH_HOLD_MS, periodMs = 0.0;
+        int x = 0, y = 0, count = 1, used = 0;
+        int fields = sscanf(p, "%lf:%d,%d%n:%lf%n:%d:%lf%n", &startMs, &x, &y, &used, &holdMs, &used,
+                            &count, &periodMs, &used);
+        if (fields < 3)
+        {
+            fprintf(stderr, "[host] CYD_TOUCH_TAPS: can't parse \"%s\"\n", p);
+            break;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            double start = (startMs + i * periodMs) * 1000.0;
+            taps.push_back({start, start + holdMs * 1000.0, (int16_t)x, (int16_t)y});
+        }
+        p += used;
+        while (*p == ';' || *p == ' ')
+            p++;
+    }
+    std::sort(taps.begin(), taps.end(), [](const HostTap &a, const HostTap &b)
+              { return a.startUs < b.startUs; });
+    return taps;
+}
+
+static const HostTap *activeTap(double now)
+{
+    for (const HostTap &tap : scriptedTaps())
+    {
+        if (tap.startUs > now)
+            break;
+        if (now < tap.endUs)
+            return &tap;
+    }
+    return nullptr;
+}
+
+// Earliest press or release after the last serviced time, cached because
+// hostSimNowUs() checks it on every call
+static double inputsServicedUs = -1.0;
+static double cachedInputEdgeUs = -1.0;
+
+static double nextInputEdgeUs()
+{
+    if (cachedInputEdgeUs >= 0.0)
+        return cachedInputEdgeUs;
+    double next = 1e300;
+    for (const HostTap &tap : scriptedTaps())
+    {
+        if (tap.startUs > next)
+            break;
+        if (tap.startUs > inputsServicedUs)
+            next = std::min(next, tap.startUs);
+        else if (tap.endUs > inputsServicedUs)
+            next = std::min(next, tap.endUs);
+    }
+    cachedInputEdgeUs = next;
+    return next;
+}
+
+static void serviceInputs(double now)
+{
+    if (servicingInputs)
+        return;
+    servicingInputs = true;
+    inputsServicedUs = now;
+    cachedInputEdgeUs = -1.0;
+
+    bool low = activeTap(now) != nullptr;
+    if (low != touchIrqLow)
+    {
+        touchIrqLow = low;
+        const HostInterrupt &irq = interrupts[HOST_TOUCH_IRQ];
+        if (irq.handler && (irq.mode & (low ? HOST_GPIO_FALLING : HOST_GPIO_RISING)))
+            irq.handler();
+    }
+    servicingInputs = false;
+}
+
+static long mapRange(long value, long inMin, long inMax, long outMin, long outMax)
+{
+    return (value - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+static uint16_t touchConversion(uint8_t command)
+{
+    const HostTap *tap = activeTap(hostSimNowUs());
+    switch ((command >> 4) & 7)
+    {
+    case 5: // X
+        return tap ? mapRange(tap->x, 0, HOST_PANEL_WIDTH - 1, HOST_TOUCH_RAW_LEFT, HOST_TOUCH_RAW_RIGHT) : 0;
+    case 1: // Y
+        return tap ? mapRange(tap->y, 0, HOST_PANEL_HEIGHT - 1, HOST_TOUCH_RAW_TOP, HOST_TOUCH_RAW_BOTTOM) : 0;
+    case 3: // Z1
+        return tap ? 1000 : 0;
+    case 4: // Z2, chosen so Z1 + 4095 - Z2 gives the modeled pressure
+        return tap ? 1000 + 4095 - HOST_TOUCH_PRESSURE : 4095;
+    default:
+        return 0;
+    }
+}
+
+void hostSimGpioWrite(uint8_t pin, uint8_t level)
+{
+    if (pin >= HOST_GPIO_COUNT)
+        return;
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    level = level ? 1 : 0;
+    if (pin == HOST_TOUCH_CS && !level)
+        touchClocks = 0;
+    if (pin == HOST_TOUCH_CLK && level && !pinLevel[HOST_TOUCH_CLK] && !pinLevel[HOST_TOUCH_CS])
+    {
+        uint32_t phase = touchClocks % 24;
+        if (phase < 8)
+            touchCommand = (touchCommand << 1) | pinLevel[HOST_TOUCH_MOSI];
+        if (phase == 7)
+            touchOutput = touchConversion(touchCommand) << 3;
+        touchClocks++;
+    }
+    pinLevel[pin] = level;
+}
+
+int hostSimGpioRead(uint8_t pin)
+{
+    if (pin >= HOST_GPIO_COUNT)
+        return 0;
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    if (pin == HOST_TOUCH_IRQ)
+    {
+        hostSimNowUs();
+        return touchIrqLow ? 0 : 1;
+    }
+    if (pin == HOST_TOUCH_MISO)
+    {
+        // Bit 15 is valid from the 9th rising edge of a conversion, one
+        // bit per edge after that
+        if (pinLevel[HOST_TOUCH_CS] || touchClocks == 0)
+            return 0;
+        uint32_t edge = (touchClocks - 1) % 24 + 1;
+        return edge >= 9 ? (touchOutput >> (24 - edge)) & 1 : 0;
+    }
+    return pinLevel[pin];
+}
+
+void hostSimAttachInterrupt(uint8_t pin, void (*handler)(), int mode)
+{
+    if (pin >= HOST_GPIO_COUNT)
+        return;
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    interrupts[pin] = {handler, mode};
+}
+
+void hostSimDetachInterrupt(uint8_t pin)
+{
+    if (pin >= HOST_GPIO_COUNT)
+        return;
+    std::lock_guard<std::recursive_mutex> guard(simLock);
+    interrupts[pin] = {nullptr, 0};
+}
+
+// ============================================================================
+// HEAP MODEL
+// ============================================================================
+
+static size_t heapInUse()
+{
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+static const size_t heapBaseline = heapInUse();
+static uint32_t heapLowWater = HOST_HEAP_BYTES;
+
+uint32_t hostSimFreeHeap()
+{
+    size_t used = heapInUse();
+    used = used > heapBaseline ? used - heapBaseline : 0;
+    uint32_t freeBytes = used < HOST_HEAP_BYTES ? (uint32_t)(HOST_HEAP_BYTES - used) : 0;
+    if (freeBytes < heapLowWater)
+        heapLowWater = freeBytes;
+    return freeBytes;
+}
+
+uint32_t hostSimMinFreeHeap()
+{
+    hostSimFreeHeap();
+    return heapLowWater;
+}
+
+uint32_t hostSimMaxAllocHeap()
+{
+    uint32_t freeBytes = hostSimFreeHeap();
+    return freeBytes < HOST_MAX_ALLOC_BYTES ? freeBytes : HOST_MAX_ALLOC_BYTES;
+}
+
+// ============================================================================
+// PANEL GRAM
+// ============================================================================
+
+static uint16_t panelRam[HOST_PANEL_WIDTH * HOST_PANEL_HEIGHT];
+static uint8_t panelRotation = 0;
+static bool panelInverted = false;
+
+uint16_t *hostSimPanelRam()
+{
+    return panelRam;
+}
+
+int32_t hostSimPanelOffset(uint8_t rotation, int32_t x, int32_t y)
+{
+    int32_t gx, gy;
+    switch (rotation & 3)
+    {
+    case 1:
+        gx = HOST_PANEL_WIDTH - 1 - y;
+        gy = x;
+        break;
+    case 2:
+        gx = HOST_PANEL_WIDTH - 1 - x;
+        gy = HOST_PANEL_HEIGHT - 1 - y;
+        break;
+    case 3:
+        gx = y;
+        gy = HOST_PANEL_HEIGHT - 1 - x;
+        break;
+    default:
+        gx = x;
+        gy = y;
+        break;
+    }
+    if (gx < 0 || gy < 0 || gx >= HOST_PANEL_WIDTH || gy >= HOST_PANEL_HEIGHT)
+        return -1;
+    return gy * HOST_PANEL_WIDTH + gx;
+}
+
+void hostSimSetRotation(uint8_t rotation)
+{
+    panelRotation = rotation & 3;
+}
+
+void hostSimSetPanelInverted(bool inverted)
+{
+    panelInverted = inverted;
+}
+
+// Command decoder state: the current command, its parameter bytes so far,
+// the column/row window and the RAMWR write position
+static uint8_t rawCommand = 0;
+static uint8_t rawParams[6];
+static size_t rawParamCount = 0;
+static int32_t rawCol0 = 0, rawCol1 = HOST_PANEL_WIDTH - 1;
+static int32_t rawRow0 = 0, rawRow1 = HOST_PANEL_HEIGHT - 1;
+static int32_t rawX = 0, rawY = 0;
+static int rawHighByte = -1;
+
+// Vertical scrolling: fixed top rows, scroll area rows and start address,
+// all in GRAM rows; off until VSCRSADR and back off on NORON
+static int32_t scrollTop = 0, scrollArea = HOST_PANEL_HEIGHT, scrollStart = 0;
+static bool scrollOn = false;
+
+void hostSimPanelCommand(uint8_t cmd)
+{
+    rawCommand = cmd;
+    rawParamCount = 0;
+    rawHighByte = -1;
+    if (cmd == HOST_TFT_RAMWR)
+    {
+        rawX = rawCol0;
+        rawY = rawRow0;
+    }
+    else if (cmd == HOST_TFT_NORON)
+    {
+        scrollOn = false;
+    }
+}
+
+void hostSimPanelData(const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (rawCommand == HOST_TFT_RAMWR)
+        {
+            if (rawHighByte < 0)
+            {
+                rawHighByte = data[i];
+                continue;
+            }
+            uint16_t color = (uint16_t)(rawHighByte << 8 | data[i]);
+            rawHighByte = -1;
+            int32_t offset = hostSimPanelOffset(panelRotation, rawX, rawY);
+            if (offset >= 0)
+                panelRam[offset] = hostSimBusCorrupt(color);
+            if (++rawX > rawCol1)
+            {
+                rawX = rawCol0;
+                if (++rawY > rawRow1)
+                    rawY = rawRow0;
+            }
+            continue;
+        }
+
+        if (rawParamCount < sizeof(rawParams))
+            rawParams[rawParamCount++] = data[i];
+        if (rawParamCount == 4 && (rawCommand == HOST_TFT_CASET || rawCommand == HOST_TFT_RASET))
+        {
+            int32_t start = rawParams[0] << 8 | rawParams[1];
+            int32_t end = rawParams[2] << 8 | rawParams[3];
+            if (rawCommand == HOST_TFT_CASET)
+            {
+                rawCol0 = start;
+                rawCol1 = end;
+            }
+            else
+            {
+                rawRow0 = start;
+                rawRow1 = end;
+            }
+        }
+        else if (rawParamCount == 6 && rawCommand == HOST_TFT_VSCRDEF)
+        {
+            // The panel ignores a definition that doesn't add up to its rows
+            int32_t top = rawParams[0] << 8 | rawParams[1];
+            int32_t area = rawParams[2] << 8 | rawParams[3];
+            int32_t bottom = rawParams[4] << 8 | rawParams[5];
+            if (area > 0 && top + area + bottom == HOST_PANEL_HEIGHT)
+            {
+                scrollTop = top;
+                scrollArea = area;
+            }
+        }
+        else if (rawParamCount == 2 && rawCommand == HOST_TFT_VSCRSADR)
+        {
+            scrollStart = rawParams[0] << 8 | rawParams[1];
+            scrollOn = true;
+        }
+    }
+}
+
+// GRAM row shown on panel row y: inside the scroll area the rows are
+// rotated to start at VSCRSADR
+static int32_t scrolledRow(int32_t y)
+{
+    if (!scrollOn || y < scrollTop || y >= scrollTop + scrollArea)
+        return y;
+    int32_t row = (scrollStart - scrollTop + y - scrollTop) % scrollArea;
+    if (row < 0)
+        row += scrollArea;
+    return scrollTop + row;
+}
+
+// Writes the panel as the viewer sees it in the current rotation, scroll
+// offset included
+bool hostSimDumpPPM(const char *path)
+{
+    bool landscape = panelRotation & 1;
+    int32_t w = landscape ? HOST_PANEL_HEIGHT : HOST_PANEL_WIDTH;
+    int32_t h = landscape ? HOST_PANEL_WIDTH : HOST_PANEL_HEIGHT;
+
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+
+    fprintf(f, "P6\n%d %d\n255\n", (int)w, (int)h);
+    for (int32_t y = 0; y < h; y++)
+    {
+        for (int32_t x = 0; x < w; x++)
+        {
+            int32_t offset = hostSimPanelOffset(panelRotation, x, y);
+            int32_t row = scrolledRow(offset / HOST_PANEL_WIDTH);
+            uint16_t c = panelRam[row * HOST_PANEL_WIDTH + offset % HOST_PANEL_WIDTH];
+            if (panelInverted)
+                c = ~c;
+            uint8_t rgb[3];
+            rgb[0] = ((c >> 11) & 0x1F) * 255 / 31;
+            rgb[1] = ((c >> 5) & 0x3F) * 255 / 63;
+            rgb[2] = (c & 0x1F) * 255 / 31;
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+    return true;
+}
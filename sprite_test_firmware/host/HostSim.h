@@ -0,0 +1,165 @@
+/*
+ * Host simulator controls for the native build
+ *
+ * The simulator keeps a virtual clock and a model of the two SPI buses on the
+ * CYD: the display bus (HSPI, SPI_FREQUENCY) and the SD card bus (VSPI).
+ *
+ *   virtual time = host CPU time * cpu scale + modeled waits
+ *
+ * Blocking transfers advance the clock to the end of their wire time, DMA
+ * transfers only occupy the bus so the CPU can keep working until the next
+ * wait. Rendering CPU cost and predicted bus-limited FPS therefore both show
+ * up in the normal millis()/micros() based measurements of the firmware.
+ *
+ * While a FreeRTOS task started with xTaskCreatePinnedToCore() is running,
+ * the tasks share one clock, so modeled waits really wait (scaled) instead
+ * of jumping it forward; one task's SD read then no longer stalls another.
+ *
+ * The touch controller is modeled at pin level: an XPT2046 on the CYD's
+ * touch pins answers bit-banged conversions and pulls its IRQ pin low while
+ * a scripted tap is down. Interrupt handlers run on whichever thread first
+ * reads the clock after the edge, and waits are split so none jumps over it.
+ *
+ * Environment variables read at startup:
+ *   CYD_SD_ROOT        directory standing in for the SD card root (default "sd")
+ *   CYD_HOST_CPU_SCALE multiplier applied to host CPU time (default 1.0)
+ *   CYD_SPI_ERROR_HZ   display writes clocked above this (effective) rate
+ *                      get bit errors, to exercise the SPI clock sweep
+ *   CYD_TOUCH_TAPS     scripted taps, "ms:x,y[:hold[:count:period]];..." with
+ *                      the start in virtual ms, the position in rotation 0
+ *                      screen pixels and the hold in ms (default 100); count
+ *                      repeats the tap every period ms
+ */
+
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ESP32 SPI clock is APB (80 MHz) divided by an integer, so requested
+// frequencies round down (55 MHz runs at 40 MHz on the wire)
+#define HOST_APB_CLOCK_HZ 80000000UL
+
+// Fixed cost of a display transaction (CS, DC toggles, driver bookkeeping).
+// Between startWrite() and endWrite() the bus stays claimed, so only the
+// first blocking transfer pays it; DMA transfers always pay the queue setup.
+#define HOST_TFT_TRANSACTION_US 2.0
+
+// Waits shorter than this are yielded in real-time mode instead of slept
+#define HOST_REALTIME_SPIN_US 200.0
+
+// CASET + RASET + RAMWR: 3 command bytes and 8 parameter bytes
+#define HOST_TFT_WINDOW_BYTES 11
+
+// Arduino-ESP32 SD.begin() default clock and FAT overheads, fitted to the
+// 2026-01-18 hardware results in docs/SPRITE_TEST_RESULTS.md
+#define HOST_SD_FREQUENCY 4000000UL
+#define HOST_SD_OPEN_US 14000.0
+#define HOST_SD_SECTOR_US 100.0
+
+// Free heap after boot on the reference board (docs/SPRITE_TEST_RESULTS.md)
+// and the usual largest free internal block on a non-PSRAM ESP32
+#define HOST_HEAP_BYTES 263504UL
+#define HOST_MAX_ALLOC_BYTES 110592UL
+
+struct HostBusStats
+{
+    uint64_t transactions;
+    uint64_t bytes;
+    double wireUs;
+};
+
+// Virtual clock
+double hostSimNowUs();
+void hostSimAdvanceTo(double us);
+void hostSimAdvanceBy(double us);
+double hostSimCpuUs();
+
+// Real-time mode, entered while any host task is running
+void hostSimTaskStarted();
+void hostSimTaskEnded();
+
+// Display bus
+uint32_t hostSimEffectiveHz(uint32_t requestedHz);
+void hostSimSetBusFrequency(uint32_t hz);
+uint32_t hostSimBusFrequency();
+double hostSimBusTransfer(size_t bytes, bool async, uint32_t hz = 0);
+void hostSimBusHold(bool hold);
+void hostSimBusWait();
+bool hostSimBusBusy();
+double hostSimBusFreeAtUs();
+
+// Display write as it arrives at the panel: above CYD_SPI_ERROR_HZ one bit
+// of every HOST_SPI_ERROR_INTERVAL pixels is flipped
+#define HOST_SPI_ERROR_INTERVAL 4099
+uint16_t hostSimBusCorrupt(uint16_t color);
+HostBusStats hostSimBusStats();
+void hostSimResetBusStats();
+
+// SD card bus
+void hostSimSdOpen();
+void hostSimSdTransfer(size_t bytes);
+HostBusStats hostSimSdStats();
+
+// Heap model
+uint32_t hostSimFreeHeap();
+uint32_t hostSimMinFreeHeap();
+uint32_t hostSimMaxAllocHeap();
+
+// GPIO and interrupts (Arduino-ESP32 mode values)
+#define HOST_GPIO_COUNT 40
+#define HOST_GPIO_RISING 0x01
+#define HOST_GPIO_FALLING 0x02
+#define HOST_GPIO_CHANGE 0x03
+
+void hostSimGpioWrite(uint8_t pin, uint8_t level);
+int hostSimGpioRead(uint8_t pin);
+void hostSimAttachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void hostSimDetachInterrupt(uint8_t pin);
+
+// XPT2046 wiring on the CYD
+#define HOST_TOUCH_CLK 25
+#define HOST_TOUCH_MOSI 32
+#define HOST_TOUCH_MISO 39
+#define HOST_TOUCH_CS 33
+#define HOST_TOUCH_IRQ 36
+
+// Raw readings at the panel edges in rotation 0 (include/CYD_Config.h) and
+// the pressure of a scripted tap
+#define HOST_TOUCH_RAW_LEFT 3570
+#define HOST_TOUCH_RAW_RIGHT 544
+#define HOST_TOUCH_RAW_TOP 3429
+#define HOST_TOUCH_RAW_BOTTOM 532
+#define HOST_TOUCH_PRESSURE 1500
+#define HOST_TOUCH_HOLD_MS 100
+
+// Panel GRAM, stored as 16-bit RGB565 colours in the viewer orientation of
+// rotation 0 (240 wide, 320 tall)
+#define HOST_PANEL_WIDTH 240
+#define HOST_PANEL_HEIGHT 320
+
+uint16_t *hostSimPanelRam();
+int32_t hostSimPanelOffset(uint8_t rotation, int32_t x, int32_t y);
+void hostSimSetRotation(uint8_t rotation);
+void hostSimSetPanelInverted(bool inverted);
+
+// Raw display traffic, as sent by writecommand()/writedata() or queued SPI
+// transactions: commands and their parameters/pixels are decoded against
+// GRAM (CASET, RASET and RAMWR; pixels arrive big-endian). VSCRDEF and
+// VSCRSADR set up vertical scrolling, which GRAM reads ignore but
+// hostSimDumpPPM() shows, as the panel would; NORON turns it off.
+#define HOST_TFT_DC 2
+#define HOST_TFT_NORON 0x13
+#define HOST_TFT_CASET 0x2A
+#define HOST_TFT_RASET 0x2B
+#define HOST_TFT_RAMWR 0x2C
+#define HOST_TFT_VSCRDEF 0x33
+#define HOST_TFT_VSCRSADR 0x37
+void hostSimPanelCommand(uint8_t cmd);
+void hostSimPanelData(const uint8_t *data, size_t len);
+bool hostSimDumpPPM(const char *path);
+
+const char *hostSimSdRoot();
+
+#endif // HOST_SIM_H
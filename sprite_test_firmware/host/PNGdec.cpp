@@ -0,0 +1,268 @@
+/*
+ * Host stand-in for bitbank2/PNGdec
+ */
+
+#include "PNGdec.h"
+
+#include <string.h>
+#include <zlib.h>
+
+static uint32_t readBE32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static int channelsFor(int pixelType)
+{
+    switch (pixelType)
+    {
+    case PNG_PIXEL_TRUECOLOR: return 3;
+    case PNG_PIXEL_GRAY_ALPHA: return 2;
+    case PNG_PIXEL_TRUECOLOR_ALPHA: return 4;
+    default: return 1;
+    }
+}
+
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc)
+        return a;
+    return pb <= pc ? b : c;
+}
+
+// ============================================================================
+// OPEN / CLOSE
+// ============================================================================
+
+int PNG::openRAM(uint8_t *pData, int iDataSize, PNG_DRAW_CALLBACK *pfnDrawCb)
+{
+    file = {0, iDataSize, pData, nullptr};
+    pfnRead = nullptr;
+    pfnSeek = nullptr;
+    pfnClose = nullptr;
+    pfnDraw = pfnDrawCb;
+    return parse();
+}
+
+int PNG::openFLASH(uint8_t *pData, int iDataSize, PNG_DRAW_CALLBACK *pfnDrawCb)
+{
+    return openRAM(pData, iDataSize, pfnDrawCb);
+}
+
+int PNG::open(const char *szFilename, PNG_OPEN_CALLBACK *pfnOpen, PNG_CLOSE_CALLBACK *pfnCloseCb,
+              PNG_READ_CALLBACK *pfnReadCb, PNG_SEEK_CALLBACK *pfnSeekCb, PNG_DRAW_CALLBACK *pfnDrawCb)
+{
+    file = {0, 0, nullptr, nullptr};
+    pfnRead = pfnReadCb;
+    pfnSeek = pfnSeekCb;
+    pfnClose = pfnCloseCb;
+    pfnDraw = pfnDrawCb;
+
+    file.fHandle = pfnOpen(szFilename, &file.iSize);
+    if (!file.fHandle)
+    {
+        lastError = PNG_INVALID_FILE;
+        return lastError;
+    }
+    return parse();
+}
+
+void PNG::close()
+{
+    if (pfnClose && file.fHandle)
+        pfnClose(file.fHandle);
+    file.fHandle = nullptr;
+
+    // Give the compressed data back: the library decodes through a fixed
+    // buffer, and a held copy would show up as lost heap
+    std::vector<uint8_t>().swap(idat);
+}
+
+// Reads the whole stream, keeping IHDR/PLTE/tRNS state and the IDAT payload
+int PNG::parse()
+{
+    std::vector<uint8_t> data(file.iSize > 0 ? file.iSize : 0);
+    if (file.pData)
+    {
+        memcpy(data.data(), file.pData, data.size());
+    }
+    else
+    {
+        size_t got = 0;
+        while (got < data.size())
+        {
+            int32_t n = pfnRead(&file, data.data() + got, (int32_t)(data.size() - got));
+            if (n <= 0)
+                break;
+            got += n;
+            file.iPos += n;
+        }
+        data.resize(got);
+    }
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (data.size() < 8 + 25 || memcmp(data.data(), signature, 8) != 0)
+    {
+        lastError = PNG_INVALID_FILE;
+        return lastError;
+    }
+
+    memset(palette, 0, sizeof(palette));
+    memset(palette + 768, 0xFF, 256);
+    alpha = 0;
+    idat.clear();
+
+    size_t pos = 8;
+    while (pos + 12 <= data.size())
+    {
+        uint32_t len = readBE32(&data[pos]);
+        const uint8_t *type = &data[pos + 4];
+        const uint8_t *body = &data[pos + 8];
+        if (pos + 12 + len > data.size())
+            break;
+
+        if (!memcmp(type, "IHDR", 4))
+        {
+            width = (int)readBE32(body);
+            height = (int)readBE32(body + 4);
+            bitDepth = body[8];
+            pixelType = body[9];
+            if (body[12] != 0 || bitDepth == 16)
+            {
+                lastError = PNG_UNSUPPORTED_FEATURE;
+                return lastError;
+            }
+            alpha = (pixelType & 4) ? 1 : 0;
+        }
+        else if (!memcmp(type, "PLTE", 4))
+        {
+            memcpy(palette, body, len < 768 ? len : 768);
+        }
+        else if (!memcmp(type, "tRNS", 4))
+        {
+            if (pixelType == PNG_PIXEL_INDEXED)
+                memcpy(palette + 768, body, len < 256 ? len : 256);
+            alpha = 1;
+        }
+        else if (!memcmp(type, "IDAT", 4))
+        {
+            idat.insert(idat.end(), body, body + len);
+        }
+        else if (!memcmp(type, "IEND", 4))
+        {
+            break;
+        }
+        pos += 12 + len;
+    }
+
+    lastError = (width > 0 && height > 0 && !idat.empty()) ? PNG_SUCCESS : PNG_INVALID_FILE;
+    return lastError;
+}
+
+// ============================================================================
+// DECODE
+// ============================================================================
+
+int PNG::decode(void *pUser, int iOptions)
+{
+    (void)iOptions;
+    int bitsPerPixel = channelsFor(pixelType) * bitDepth;
+    int pitch = (width * bitsPerPixel + 7) / 8;
+    int pixelBytes = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+
+    std::vector<uint8_t> raw((size_t)(pitch + 1) * height);
+    uLongf rawLen = raw.size();
+    if (uncompress(raw.data(), &rawLen, idat.data(), idat.size()) != Z_OK || rawLen != raw.size())
+    {
+        lastError = PNG_DECODE_ERROR;
+        return lastError;
+    }
+
+    std::vector<uint8_t> prev(pitch, 0), cur(pitch);
+    PNGDRAW draw;
+    draw.iWidth = width;
+    draw.iPitch = pitch;
+    draw.iPixelType = pixelType;
+    draw.iBpp = bitDepth;
+    draw.iHasAlpha = alpha;
+    draw.pUser = pUser;
+    draw.pPalette = palette;
+    draw.pFastPalette = nullptr;
+
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t *line = &raw[(size_t)y * (pitch + 1)];
+        uint8_t filter = line[0];
+        for (int i = 0; i < pitch; i++)
+        {
+            uint8_t a = i >= pixelBytes ? cur[i - pixelBytes] : 0;
+            uint8_t b = prev[i];
+            uint8_t c = i >= pixelBytes ? prev[i - pixelBytes] : 0;
+            uint8_t x = line[1 + i];
+            switch (filter)
+            {
+            case 1: x += a; break;
+            case 2: x += b; break;
+            case 3: x += (uint8_t)((a + b) >> 1); break;
+            case 4: x += paeth(a, b, c); break;
+            default: break;
+            }
+            cur[i] = x;
+        }
+
+        draw.y = y;
+        draw.pPixels = cur.data();
+        if (pfnDraw && !pfnDraw(&draw))
+        {
+            lastError = PNG_QUIT_EARLY;
+            return lastError;
+        }
+        prev.swap(cur);
+    }
+    lastError = PNG_SUCCESS;
+    return lastError;
+}
+
+// 8-bit sources only; alpha is blended against the RGB888 background colour
+void PNG::getLineAsRGB565(PNGDRAW *pDraw, uint16_t *pPixels, int iEndianness, uint32_t u32Bkgd)
+{
+    uint8_t bgR = (u32Bkgd >> 16) & 0xFF, bgG = (u32Bkgd >> 8) & 0xFF, bgB = u32Bkgd & 0xFF;
+    const uint8_t *s = pDraw->pPixels;
+    for (int x = 0; x < pDraw->iWidth; x++)
+    {
+        uint8_t r, g, b, a = 255;
+        switch (pDraw->iPixelType)
+        {
+        case PNG_PIXEL_TRUECOLOR_ALPHA:
+            r = s[x * 4]; g = s[x * 4 + 1]; b = s[x * 4 + 2]; a = s[x * 4 + 3];
+            break;
+        case PNG_PIXEL_TRUECOLOR:
+            r = s[x * 3]; g = s[x * 3 + 1]; b = s[x * 3 + 2];
+            break;
+        case PNG_PIXEL_INDEXED:
+            r = pDraw->pPalette[s[x] * 3];
+            g = pDraw->pPalette[s[x] * 3 + 1];
+            b = pDraw->pPalette[s[x] * 3 + 2];
+            a = pDraw->iHasAlpha ? pDraw->pPalette[768 + s[x]] : 255;
+            break;
+        case PNG_PIXEL_GRAY_ALPHA:
+            r = g = b = s[x * 2]; a = s[x * 2 + 1];
+            break;
+        default:
+            r = g = b = s[x];
+            break;
+        }
+        if (a != 255)
+        {
+            r = (r * a + bgR * (255 - a)) >> 8;
+            g = (g * a + bgG * (255 - a)) >> 8;
+            b = (b * a + bgB * (255 - a)) >> 8;
+        }
+        uint16_t c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+        pPixels[x] = iEndianness == PNG_RGB565_BIG_ENDIAN ? (uint16_t)((c >> 8) | (c << 8)) : c;
+    }
+}
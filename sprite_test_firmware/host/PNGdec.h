@@ -0,0 +1,107 @@
+/*
+ * Host stand-in for bitbank2/PNGdec
+ *
+ * Decodes non-interlaced 8-bit (and 1/2/4-bit indexed or grayscale) PNGs with
+ * zlib and reports rows through the same PNGDRAW callback as the library:
+ * iBpp is the bit depth per channel, not per pixel, and pPalette holds 256
+ * RGB triplets followed by 256 tRNS alpha values.
+ */
+
+#ifndef HOST_PNGDEC_H
+#define HOST_PNGDEC_H
+
+#include <stdint.h>
+#include <vector>
+
+enum
+{
+    PNG_PIXEL_GRAYSCALE = 0,
+    PNG_PIXEL_TRUECOLOR = 2,
+    PNG_PIXEL_INDEXED = 3,
+    PNG_PIXEL_GRAY_ALPHA = 4,
+    PNG_PIXEL_TRUECOLOR_ALPHA = 6
+};
+
+enum
+{
+    PNG_SUCCESS = 0,
+    PNG_INVALID_PARAMETER,
+    PNG_DECODE_ERROR,
+    PNG_MEM_ERROR,
+    PNG_NO_BUFFER,
+    PNG_UNSUPPORTED_FEATURE,
+    PNG_INVALID_FILE,
+    PNG_TOO_BIG,
+    PNG_QUIT_EARLY
+};
+
+enum
+{
+    PNG_RGB565_LITTLE_ENDIAN = 0,
+    PNG_RGB565_BIG_ENDIAN
+};
+
+typedef struct png_file_tag
+{
+    int32_t iPos;
+    int32_t iSize;
+    uint8_t *pData;
+    void *fHandle;
+} PNGFILE;
+
+typedef struct png_draw_tag
+{
+    int y;
+    int iWidth;
+    int iPitch;
+    int iPixelType;
+    int iBpp;
+    int iHasAlpha;
+    void *pUser;
+    uint8_t *pPalette;
+    uint16_t *pFastPalette;
+    uint8_t *pPixels;
+} PNGDRAW;
+
+typedef int32_t(PNG_READ_CALLBACK)(PNGFILE *pFile, uint8_t *pBuf, int32_t iLen);
+typedef int32_t(PNG_SEEK_CALLBACK)(PNGFILE *pFile, int32_t iPosition);
+typedef void *(PNG_OPEN_CALLBACK)(const char *szFilename, int32_t *pFileSize);
+typedef void(PNG_CLOSE_CALLBACK)(void *pHandle);
+typedef int(PNG_DRAW_CALLBACK)(PNGDRAW *);
+
+class PNG
+{
+public:
+    int openRAM(uint8_t *pData, int iDataSize, PNG_DRAW_CALLBACK *pfnDraw);
+    int openFLASH(uint8_t *pData, int iDataSize, PNG_DRAW_CALLBACK *pfnDraw);
+    int open(const char *szFilename, PNG_OPEN_CALLBACK *pfnOpen, PNG_CLOSE_CALLBACK *pfnClose,
+             PNG_READ_CALLBACK *pfnRead, PNG_SEEK_CALLBACK *pfnSeek, PNG_DRAW_CALLBACK *pfnDraw);
+    void close();
+    int decode(void *pUser, int iOptions);
+
+    int getWidth() { return width; }
+    int getHeight() { return height; }
+    int getBpp() { return bitDepth; }
+    int hasAlpha() { return alpha; }
+    int isInterlaced() { return 0; }
+    int getPixelType() { return pixelType; }
+    int getLastError() { return lastError; }
+    uint8_t *getPalette() { return palette; }
+    void getLineAsRGB565(PNGDRAW *pDraw, uint16_t *pPixels, int iEndianness, uint32_t u32Bkgd);
+
+private:
+    int parse();
+
+    PNGFILE file = {0, 0, nullptr, nullptr};
+    PNG_READ_CALLBACK *pfnRead = nullptr;
+    PNG_SEEK_CALLBACK *pfnSeek = nullptr;
+    PNG_CLOSE_CALLBACK *pfnClose = nullptr;
+    PNG_DRAW_CALLBACK *pfnDraw = nullptr;
+
+    std::vector<uint8_t> idat;
+    uint8_t palette[1024];
+    int width = 0, height = 0, bitDepth = 0, pixelType = 0, alpha = 0;
+    int lastError = PNG_SUCCESS;
+};
+
+#endif // HOST_PNGDEC_H
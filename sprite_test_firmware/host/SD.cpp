@@ -0,0 +1,132 @@
+/*
+ * Host stand-in for the Arduino-ESP32 SD library
+ */
+
+#include "SD.h"
+#include "HostSim.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+SDClass SD;
+
+static std::string hostPath(const char *path)
+{
+    std::string full(hostSimSdRoot());
+    if (path[0] != '/')
+        full += '/';
+    return full + path;
+}
+
+// ============================================================================
+// FILE
+// ============================================================================
+
+size_t File::read(uint8_t *buf, size_t size)
+{
+    if (!handle)
+        return 0;
+    size_t n = fread(buf, 1, size, handle.get());
+    hostSimSdTransfer(n);
+    return n;
+}
+
+int File::read()
+{
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+    if (!handle)
+        return 0;
+    size_t n = fwrite(buf, 1, size, handle.get());
+    hostSimSdTransfer(n);
+    return n;
+}
+
+bool File::seek(uint32_t pos)
+{
+    return handle && fseek(handle.get(), pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const
+{
+    return handle ? (size_t)ftell(handle.get()) : 0;
+}
+
+size_t File::size() const
+{
+    if (!handle)
+        return 0;
+    struct stat st;
+    if (fstat(fileno(handle.get()), &st) != 0)
+        return 0;
+    return (size_t)st.st_size;
+}
+
+int File::available() const
+{
+    return (int)(size() - position());
+}
+
+void File::close()
+{
+    handle.reset();
+}
+
+// ============================================================================
+// SD
+// ============================================================================
+
+bool SDClass::begin(uint8_t ssPin, SPIClass &spi, uint32_t frequency, const char *mountpoint,
+                    uint8_t maxFiles, bool format_if_empty)
+{
+    (void)ssPin;
+    (void)spi;
+    (void)frequency;
+    (void)mountpoint;
+    (void)maxFiles;
+    (void)format_if_empty;
+
+    // Missing assets surface as open failures in the tests themselves, so a
+    // missing root only warns instead of halting setup()
+    struct stat st;
+    if (stat(hostSimSdRoot(), &st) != 0 || !S_ISDIR(st.st_mode))
+    {
+        fprintf(stderr, "[host] SD root '%s' not found (set CYD_SD_ROOT)\n", hostSimSdRoot());
+    }
+    return true;
+}
+
+File SDClass::open(const char *path, const char *mode)
+{
+    File file;
+    std::string full = hostPath(path);
+    const char *fmode = mode[0] == 'w' ? "wb" : (mode[0] == 'a' ? "ab" : "rb");
+
+    hostSimSdOpen();
+    FILE *f = fopen(full.c_str(), fmode);
+    if (f)
+    {
+        file.handle = std::shared_ptr<FILE>(f, fclose);
+        file.path = path;
+    }
+    return file;
+}
+
+bool SDClass::exists(const char *path)
+{
+    return access(hostPath(path).c_str(), F_OK) == 0;
+}
+
+bool SDClass::remove(const char *path)
+{
+    return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool SDClass::mkdir(const char *path)
+{
+    return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
@@ -0,0 +1,59 @@
+/*
+ * Host stand-in for the Arduino-ESP32 SD library
+ *
+ * Paths are resolved below hostSimSdRoot(). Opens and reads are charged to
+ * the simulated SD bus, so load benchmarks see card-like latency.
+ */
+
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include "Arduino.h"
+#include "SPI.h"
+
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+class File
+{
+public:
+    File() {}
+
+    size_t read(uint8_t *buf, size_t size);
+    int read();
+    size_t write(const uint8_t *buf, size_t size);
+    size_t write(uint8_t b) { return write(&b, 1); }
+    bool seek(uint32_t pos);
+    size_t position() const;
+    size_t size() const;
+    int available() const;
+    void close();
+    const char *name() const { return path.c_str(); }
+    operator bool() const { return (bool)handle; }
+
+private:
+    friend class SDClass;
+    std::shared_ptr<FILE> handle;
+    std::string path;
+};
+
+class SDClass
+{
+public:
+    bool begin(uint8_t ssPin = 5, SPIClass &spi = SPI, uint32_t frequency = 4000000,
+               const char *mountpoint = "/sd", uint8_t maxFiles = 5, bool format_if_empty = false);
+    void end() {}
+    File open(const char *path, const char *mode = FILE_READ);
+    File open(const String &path, const char *mode = FILE_READ) { return open(path.c_str(), mode); }
+    bool exists(const char *path);
+    bool remove(const char *path);
+    bool mkdir(const char *path);
+    uint64_t cardSize() { return 8ULL * 1024 * 1024 * 1024; }
+};
+
+extern SDClass SD;
+
+#endif // HOST_SD_H
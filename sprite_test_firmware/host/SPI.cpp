@@ -0,0 +1,33 @@
+/*
+ * Host stand-in for the Arduino-ESP32 SPI driver
+ */
+
+#include "SPI.h"
+#include "HostSim.h"
+
+SPIClass SPI(VSPI);
+
+void SPIClass::begin(int8_t sck, int8_t miso, int8_t mosi, int8_t ss)
+{
+    (void)sck;
+    (void)miso;
+    (void)mosi;
+    (void)ss;
+}
+
+void SPIClass::setFrequency(uint32_t freq)
+{
+    clockHz = freq;
+    if (drivesDisplay)
+        hostSimSetBusFrequency(freq);
+}
+
+uint32_t SPIClass::getClockDivider()
+{
+    return HOST_APB_CLOCK_HZ / hostSimEffectiveHz(clockHz);
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+    setFrequency(settings._clock);
+}
@@ -0,0 +1,59 @@
+/*
+ * Host stand-in for the Arduino-ESP32 SPI driver
+ *
+ * The display bus instance (TFT_eSPI::getSPIinstance()) forwards clock
+ * changes to the simulated display bus; every other instance is inert.
+ */
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+#define HSPI 2
+#define VSPI 3
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+#define SPI_LSBFIRST 0
+#define SPI_MSBFIRST 1
+#ifndef MSBFIRST
+#define LSBFIRST SPI_LSBFIRST
+#define MSBFIRST SPI_MSBFIRST
+#endif
+
+class SPISettings
+{
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = SPI_MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {}
+    uint32_t _clock;
+    uint8_t _bitOrder;
+    uint8_t _dataMode;
+};
+
+class SPIClass
+{
+public:
+    explicit SPIClass(uint8_t spiBus = HSPI) : bus(spiBus), drivesDisplay(false), clockHz(1000000) {}
+
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1);
+    void end() {}
+    void setFrequency(uint32_t freq);
+    uint32_t getClockDivider();
+    void beginTransaction(SPISettings settings);
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data) { return data; }
+    uint8_t bus;
+    bool drivesDisplay;
+
+private:
+    uint32_t clockHz;
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
@@ -0,0 +1,113 @@
+/*
+ * Host stand-in for the ESP-IDF SPI master driver
+ *
+ * Every device is taken to sit on the display bus; see driver/spi_master.h.
+ */
+
+#include "driver/spi_master.h"
+#include "HostSim.h"
+
+#include <deque>
+#include <stdio.h>
+
+struct HostSpiTransfer
+{
+    spi_transaction_t *trans;
+    bool data;
+    double endUs;
+};
+
+struct HostSpiDevice
+{
+    spi_device_interface_config_t config;
+    std::deque<HostSpiTransfer> inFlight;
+};
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle)
+{
+    (void)host;
+    if (!config || !handle || config->queue_size <= 0 || config->clock_speed_hz <= 0)
+        return ESP_ERR_INVALID_ARG;
+    HostSpiDevice *device = new HostSpiDevice();
+    device->config = *config;
+    *handle = device;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle)
+{
+    if (!handle)
+        return ESP_ERR_INVALID_ARG;
+    if (!handle->inFlight.empty())
+    {
+        fprintf(stderr, "[host] spi_bus_remove_device with %u results not collected\n",
+                (unsigned)handle->inFlight.size());
+        return ESP_ERR_INVALID_STATE;
+    }
+    delete handle;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, TickType_t ticksToWait)
+{
+    if (!handle || !trans || (trans->flags & SPI_TRANS_USE_TXDATA && trans->length > 32))
+        return ESP_ERR_INVALID_ARG;
+
+    // A full queue blocks until the oldest transfer still on the wire ends
+    size_t unfinished = 0;
+    double oldestEndUs = 0.0;
+    double now = hostSimNowUs();
+    for (const HostSpiTransfer &t : handle->inFlight)
+    {
+        if (t.endUs > now && unfinished++ == 0)
+            oldestEndUs = t.endUs;
+    }
+    if (unfinished >= (size_t)handle->config.queue_size)
+    {
+        if (ticksToWait == 0)
+            return ESP_ERR_TIMEOUT;
+        hostSimAdvanceTo(oldestEndUs);
+    }
+
+    if (handle->config.pre_cb)
+        handle->config.pre_cb(trans);
+    bool data = hostSimGpioRead(HOST_TFT_DC) != 0;
+
+    hostSimBusTransfer((trans->length + 7) / 8, true, (uint32_t)handle->config.clock_speed_hz);
+    handle->inFlight.push_back({trans, data, hostSimBusFreeAtUs()});
+    return ESP_OK;
+}
+
+// Bytes reach the panel only here, so a buffer reused before its result is
+// collected shows up on screen
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, TickType_t ticksToWait)
+{
+    if (!handle || !trans)
+        return ESP_ERR_INVALID_ARG;
+    if (handle->inFlight.empty())
+        return ESP_ERR_TIMEOUT;
+
+    HostSpiTransfer t = handle->inFlight.front();
+    if (ticksToWait == 0 && t.endUs > hostSimNowUs())
+        return ESP_ERR_TIMEOUT;
+    hostSimAdvanceTo(t.endUs);
+    handle->inFlight.pop_front();
+
+    size_t bytes = (t.trans->length + 7) / 8;
+    const uint8_t *tx = t.trans->flags & SPI_TRANS_USE_TXDATA ? t.trans->tx_data
+                                                              : (const uint8_t *)t.trans->tx_buffer;
+    if (tx)
+    {
+        if (t.data)
+            hostSimPanelData(tx, bytes);
+        else
+            for (size_t i = 0; i < bytes; i++)
+                hostSimPanelCommand(tx[i]);
+    }
+
+    if (handle->config.post_cb)
+        handle->config.post_cb(t.trans);
+    *trans = t.trans;
+    return ESP_OK;
+}
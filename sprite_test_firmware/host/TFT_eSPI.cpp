@@ -0,0 +1,877 @@
+/*
+ * Host stand-in for TFT_eSPI (ILI9341, 4-wire SPI)
+ */
+
+#include "TFT_eSPI.h"
+#include "HostSim.h"
+
+static inline uint16_t swap16(uint16_t v)
+{
+    return (uint16_t)((v >> 8) | (v << 8));
+}
+
+// Placeholder 5x7 glyph columns: stable per character, blank for space
+static uint8_t glyphColumn(uint8_t c, int col)
+{
+    if (c <= ' ' || col >= 5)
+        return 0;
+    uint32_t h = (uint32_t)c * 2654435761u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    return (uint8_t)(((h >> (col * 6)) & 0x3F) | (col == 0 || col == 4 ? 0x40 : 0));
+}
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _init_width(w), _init_height(h), _width(w), _height(h), rotation(0), _swapBytes(false),
+      _vpX(0), _vpY(0), _vpW(w), _vpH(h), _vpDatum(false),
+      cursor_x(0), cursor_y(0), textcolor(TFT_WHITE), textbgcolor(TFT_WHITE), textsize(1),
+      textfont(1), textdatum(TL_DATUM), textwrapX(true),
+      winX0(0), winY0(0), winX1(0), winY1(0), winX(0), winY(0),
+      inTransaction(false), dmaReady(false), dmaJob{false, 0, 0, 0, 0, nullptr, 0}
+{
+}
+
+SPIClass &TFT_eSPI::getSPIinstance()
+{
+    static SPIClass spi(HSPI);
+    spi.drivesDisplay = true;
+    return spi;
+}
+
+void TFT_eSPI::init(uint8_t tc)
+{
+    (void)tc;
+    hostSimSetBusFrequency(SPI_FREQUENCY);
+    setRotation(0);
+    invertDisplay(false);
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+    finishDma();
+    rotation = r & 3;
+    hostSimSetRotation(rotation);
+    if (rotation & 1)
+    {
+        _width = _init_height;
+        _height = _init_width;
+    }
+    else
+    {
+        _width = _init_width;
+        _height = _init_height;
+    }
+    resetViewport();
+    hostSimBusTransfer(2, false);
+}
+
+void TFT_eSPI::invertDisplay(bool i)
+{
+    writecommand(i ? TFT_INVON : TFT_INVOFF);
+}
+
+void TFT_eSPI::writecommand(uint8_t c)
+{
+    finishDma();
+    if (c == TFT_INVON || c == TFT_INVOFF)
+        hostSimSetPanelInverted(c == TFT_INVON);
+    hostSimPanelCommand(c);
+    hostSimBusTransfer(1, false);
+}
+
+void TFT_eSPI::writedata(uint8_t d)
+{
+    finishDma();
+    hostSimPanelData(&d, 1);
+    hostSimBusTransfer(1, false);
+}
+
+void TFT_eSPI::startWrite()
+{
+    inTransaction = true;
+    hostSimBusHold(true);
+}
+
+// Ending the transaction releases the bus; the next one starts at the
+// configured SPI_FREQUENCY again, as with SUPPORT_TRANSACTIONS on ESP32
+void TFT_eSPI::endWrite()
+{
+    inTransaction = false;
+    hostSimBusHold(false);
+    hostSimSetBusFrequency(SPI_FREQUENCY);
+}
+
+// ============================================================================
+// PANEL ACCESS
+// ============================================================================
+
+void TFT_eSPI::panelWrite(int32_t x, int32_t y, uint16_t color)
+{
+    int32_t offset = hostSimPanelOffset(rotation, x, y);
+    if (offset >= 0)
+        hostSimPanelRam()[offset] = hostSimBusCorrupt(color);
+}
+
+uint16_t TFT_eSPI::panelRead(int32_t x, int32_t y)
+{
+    int32_t offset = hostSimPanelOffset(rotation, x, y);
+    return offset >= 0 ? hostSimPanelRam()[offset] : 0;
+}
+
+void TFT_eSPI::windowWrite(uint16_t color)
+{
+    panelWrite(winX, winY, color);
+    if (++winX > winX1)
+    {
+        winX = winX0;
+        if (++winY > winY1)
+            winY = winY0;
+    }
+}
+
+// Applies a finished DMA transfer. The source buffer is read only now, so
+// reusing it before dmaWait() corrupts the frame just like on the board.
+void TFT_eSPI::finishDma()
+{
+    if (!dmaJob.active)
+        return;
+    dmaJob.active = false;
+    hostSimBusWait();
+
+    winX0 = dmaJob.x0;
+    winY0 = dmaJob.y0;
+    winX1 = dmaJob.x1;
+    winY1 = dmaJob.y1;
+    winX = winX0;
+    winY = winY0;
+    for (uint32_t i = 0; i < dmaJob.len; i++)
+        windowWrite(swap16(dmaJob.data[i]));
+}
+
+// Applies the viewport datum and clips to the viewport, leaving x/y in
+// absolute screen coordinates and dx/dy as the offset into the source
+bool TFT_eSPI::clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h, int32_t &dx, int32_t &dy)
+{
+    dx = 0;
+    dy = 0;
+    if (_vpDatum)
+    {
+        x += _vpX;
+        y += _vpY;
+    }
+    if (x >= _vpX + _vpW || y >= _vpY + _vpH || w <= 0 || h <= 0)
+        return false;
+    if (x < _vpX)
+    {
+        dx = _vpX - x;
+        w -= dx;
+        x = _vpX;
+    }
+    if (y < _vpY)
+    {
+        dy = _vpY - y;
+        h -= dy;
+        y = _vpY;
+    }
+    if (x + w > _vpX + _vpW)
+        w = _vpX + _vpW - x;
+    if (y + h > _vpY + _vpH)
+        h = _vpY + _vpH - y;
+    return w > 0 && h > 0;
+}
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum)
+{
+    int32_t x1 = min(x + w, _width);
+    int32_t y1 = min(y + h, _height);
+    _vpX = max(x, (int32_t)0);
+    _vpY = max(y, (int32_t)0);
+    _vpW = max(x1 - _vpX, (int32_t)0);
+    _vpH = max(y1 - _vpY, (int32_t)0);
+    _vpDatum = vpDatum;
+}
+
+void TFT_eSPI::resetViewport()
+{
+    _vpX = 0;
+    _vpY = 0;
+    _vpW = _width;
+    _vpH = _height;
+    _vpDatum = false;
+}
+
+// ============================================================================
+// RAW WINDOW ACCESS
+// ============================================================================
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    finishDma();
+    winX0 = x0;
+    winY0 = y0;
+    winX1 = x1;
+    winY1 = y1;
+    winX = x0;
+    winY = y0;
+    hostSimBusTransfer(HOST_TFT_WINDOW_BYTES, false);
+}
+
+void TFT_eSPI::pushColor(uint16_t color)
+{
+    pushBlock(color, 1);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len)
+{
+    pushBlock(color, len);
+}
+
+void TFT_eSPI::pushColors(uint16_t *data, uint32_t len, bool swap)
+{
+    finishDma();
+    for (uint32_t i = 0; i < len; i++)
+        windowWrite(swap ? data[i] : swap16(data[i]));
+    hostSimBusTransfer(len * 2, false);
+}
+
+void TFT_eSPI::pushPixels(const void *data, uint32_t len)
+{
+    pushColors((uint16_t *)data, len, _swapBytes);
+}
+
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len)
+{
+    finishDma();
+    for (uint32_t i = 0; i < len; i++)
+        windowWrite(color);
+    hostSimBusTransfer(len * 2, false);
+}
+
+// ============================================================================
+// PRIMITIVES
+// ============================================================================
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    int32_t w = 1, h = 1, dx, dy;
+    if (!clip(x, y, w, h, dx, dy))
+        return;
+    finishDma();
+    panelWrite(x, y, (uint16_t)color);
+    hostSimBusTransfer(HOST_TFT_WINDOW_BYTES + 2, false);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    int32_t dx, dy;
+    if (!clip(x, y, w, h, dx, dy))
+        return;
+    finishDma();
+    for (int32_t j = 0; j < h; j++)
+        for (int32_t i = 0; i < w; i++)
+            panelWrite(x + i, y + j, (uint16_t)color);
+    hostSimBusTransfer(HOST_TFT_WINDOW_BYTES + (size_t)w * h * 2, false);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+    fillRect(0, 0, _width, _height, color);
+}
+
+// ============================================================================
+// IMAGES
+// ============================================================================
+
+void TFT_eSPI::pushImageRows(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, bool swap)
+{
+    int32_t dx, dy;
+    int32_t stride = w;
+    if (!clip(x, y, w, h, dx, dy))
+        return;
+    finishDma();
+    data += dx + dy * stride;
+    for (int32_t j = 0; j < h; j++)
+    {
+        for (int32_t i = 0; i < w; i++)
+            panelWrite(x + i, y + j, swap ? data[i] : swap16(data[i]));
+        data += stride;
+    }
+    hostSimBusTransfer(HOST_TFT_WINDOW_BYTES + (size_t)w * h * 2, false);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+    pushImageRows(x, y, w, h, data, _swapBytes);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+    pushImageRows(x, y, w, h, data, _swapBytes);
+}
+
+// One window per opaque run, as in the library's line-buffered version
+void TFT_eSPI::pushImageTransparent(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent)
+{
+    int32_t dx, dy;
+    int32_t stride = w;
+    if (!clip(x, y, w, h, dx, dy))
+        return;
+    finishDma();
+    data += dx + dy * stride;
+
+    // The little endian transparent colour must be swapped for big endian images
+    if (!_swapBytes)
+        transparent = swap16(transparent);
+
+    size_t bytes = 0;
+    for (int32_t j = 0; j < h; j++)
+    {
+        int32_t run = 0;
+        for (int32_t i = 0; i <= w; i++)
+        {
+            if (i < w && data[i] != transparent)
+            {
+                panelWrite(x + i, y + j, _swapBytes ? data[i] : swap16(data[i]));
+                run++;
+            }
+            else if (run)
+            {
+                bytes += HOST_TFT_WINDOW_BYTES + run * 2;
+                run = 0;
+            }
+        }
+        data += stride;
+    }
+    if (bytes)
+        hostSimBusTransfer(bytes, false);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t transparent)
+{
+    pushImageTransparent(x, y, w, h, data, transparent);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent)
+{
+    pushImageTransparent(x, y, w, h, data, transparent);
+}
+
+void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+    bool swap = _swapBytes;
+    _swapBytes = false;
+    pushImage(x, y, w, h, data);
+    _swapBytes = swap;
+}
+
+void TFT_eSPI::readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+    if (w <= 0 || h <= 0)
+        return;
+    finishDma();
+    for (int32_t j = 0; j < h; j++)
+        for (int32_t i = 0; i < w; i++)
+            *data++ = swap16(panelRead(x + i, y + j));
+
+    // RAMRD: one dummy byte, then 18-bit colour as three bytes per pixel
+    hostSimBusTransfer(HOST_TFT_WINDOW_BYTES + 1 + (size_t)w * h * 3, false, SPI_READ_FREQUENCY);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y)
+{
+    uint16_t color;
+    readRect(x, y, 1, 1, &color);
+    return swap16(color);
+}
+
+// ============================================================================
+// DMA
+// ============================================================================
+
+bool TFT_eSPI::initDMA(bool ctrl_cs)
+{
+    (void)ctrl_cs;
+    dmaReady = true;
+    return true;
+}
+
+void TFT_eSPI::deInitDMA()
+{
+    dmaWait();
+    dmaReady = false;
+}
+
+// Like the library, swaps the caller's image in place when no bounce buffer
+// is given and setSwapBytes(true) is active
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer)
+{
+    int32_t dx, dy;
+    int32_t stride = w;
+    int32_t ox = x, oy = y, oh = h;
+    if (!clip(x, y, w, h, dx, dy))
+        return;
+
+    // Clipped images without a bounce buffer go out as a blocking push
+    if (!dmaReady || (!buffer && (w != stride || h != oh)))
+    {
+        pushImage(ox, oy, stride, oh, data);
+        return;
+    }
+    finishDma();
+
+    uint32_t len = (uint32_t)w * h;
+    uint16_t *src = data + dx + dy * stride;
+    if (buffer)
+    {
+        for (int32_t j = 0; j < h; j++)
+            memcpy(buffer + j * w, src + j * stride, w * 2);
+        src = buffer;
+    }
+    if (_swapBytes)
+        for (uint32_t i = 0; i < len; i++)
+            src[i] = swap16(src[i]);
+
+    dmaJob = {true, x, y, x + w - 1, y + h - 1, src, len};
+    hostSimBusTransfer(HOST_TFT_WINDOW_BYTES, false);
+    hostSimBusTransfer(len * 2, true);
+}
+
+void TFT_eSPI::pushPixelsDMA(uint16_t *image, uint32_t len)
+{
+    if (!dmaReady)
+    {
+        pushPixels(image, len);
+        return;
+    }
+    finishDma();
+    if (_swapBytes)
+        for (uint32_t i = 0; i < len; i++)
+            image[i] = swap16(image[i]);
+
+    dmaJob = {true, winX0, winY0, winX1, winY1, image, len};
+    hostSimBusTransfer(len * 2, true);
+}
+
+bool TFT_eSPI::dmaBusy()
+{
+    if (hostSimBusBusy())
+        return true;
+    finishDma();
+    return false;
+}
+
+void TFT_eSPI::dmaWait()
+{
+    finishDma();
+    hostSimBusWait();
+}
+
+// ============================================================================
+// COLOUR HELPERS
+// ============================================================================
+
+uint16_t TFT_eSPI::color565(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc)
+{
+    uint16_t fgR = ((fgc >> 10) & 0x3E) + 1;
+    uint16_t fgG = ((fgc >> 4) & 0x7E) + 1;
+    uint16_t fgB = ((fgc << 1) & 0x3E) + 1;
+    uint16_t bgR = ((bgc >> 10) & 0x3E) + 1;
+    uint16_t bgG = ((bgc >> 4) & 0x7E) + 1;
+    uint16_t bgB = ((bgc << 1) & 0x3E) + 1;
+    uint16_t r = (((fgR * alpha) + (bgR * (255 - alpha))) >> 9);
+    uint16_t g = (((fgG * alpha) + (bgG * (255 - alpha))) >> 9);
+    uint16_t b = (((fgB * alpha) + (bgB * (255 - alpha))) >> 9);
+    return (r << 11) | (g << 5) | (b << 0);
+}
+
+// ============================================================================
+// TEXT
+// ============================================================================
+
+void TFT_eSPI::setTextColor(uint16_t color)
+{
+    textcolor = textbgcolor = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill)
+{
+    (void)bgfill;
+    textcolor = fgcolor;
+    textbgcolor = bgcolor;
+}
+
+void TFT_eSPI::setTextSize(uint8_t size)
+{
+    textsize = size ? size : 1;
+}
+
+void TFT_eSPI::setTextFont(uint8_t font)
+{
+    textfont = font ? font : 1;
+}
+
+void TFT_eSPI::setTextDatum(uint8_t datum)
+{
+    textdatum = datum;
+}
+
+void TFT_eSPI::setTextWrap(bool wrapX, bool wrapY)
+{
+    (void)wrapY;
+    textwrapX = wrapX;
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y)
+{
+    cursor_x = x;
+    cursor_y = y;
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y, uint8_t font)
+{
+    setTextFont(font);
+    setCursor(x, y);
+}
+
+// Numbered fonts are drawn as the GLCD cell scaled to the font height
+uint8_t TFT_eSPI::fontScale(uint8_t font)
+{
+    int16_t h = fontHeight(font) / textsize;
+    return (uint8_t)max(1, (h + 4) / 8);
+}
+
+// Same transfer pattern as the library: a single 6x8 window when the
+// background is drawn at size 1, otherwise one transfer per set pixel
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+{
+    if (x >= _width || y >= _height || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0)
+        return;
+
+    if (color == bg || size != 1)
+    {
+        for (int8_t i = 0; i < 6; i++)
+        {
+            uint8_t line = glyphColumn((uint8_t)c, i);
+            for (int8_t j = 0; j < 8; j++, line >>= 1)
+            {
+                if (line & 1)
+                {
+                    if (size == 1)
+                        drawPixel(x + i, y + j, color);
+                    else
+                        fillRect(x + i * size, y + j * size, size, size, color);
+                }
+                else if (bg != color)
+                {
+                    fillRect(x + i * size, y + j * size, size, size, bg);
+                }
+            }
+        }
+        return;
+    }
+
+    setWindow(x, y, x + 5, y + 7);
+    finishDma();
+    for (int8_t j = 0; j < 8; j++)
+        for (int8_t i = 0; i < 6; i++)
+            windowWrite((glyphColumn((uint8_t)c, i) >> j) & 1 ? color : bg);
+    hostSimBusTransfer(6 * 8 * 2, false);
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y)
+{
+    return drawString(string, x, y, textfont);
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t x, int32_t y, uint8_t font)
+{
+    int16_t w = textWidth(string, font);
+    int16_t h = fontHeight(font);
+    switch (textdatum)
+    {
+    case TC_DATUM: x -= w / 2; break;
+    case TR_DATUM: x -= w; break;
+    case ML_DATUM: y -= h / 2; break;
+    case MC_DATUM: x -= w / 2; y -= h / 2; break;
+    case MR_DATUM: x -= w; y -= h / 2; break;
+    case BL_DATUM: y -= h; break;
+    case BC_DATUM: x -= w / 2; y -= h; break;
+    case BR_DATUM: x -= w; y -= h; break;
+    default: break;
+    }
+
+    if (fontLoaded)
+    {
+        int16_t cx = cursor_x, cy = cursor_y;
+        cursor_x = x;
+        cursor_y = y;
+        for (const char *p = string; *p; p++)
+            drawGlyph((uint8_t)*p);
+        cursor_x = cx;
+        cursor_y = cy;
+        return w;
+    }
+
+    uint8_t size = textsize * fontScale(font);
+    for (const char *p = string; *p; p++, x += 6 * size)
+        drawChar(x, y, (uint8_t)*p, textcolor, textbgcolor, size);
+    return w;
+}
+
+int16_t TFT_eSPI::drawString(const String &string, int32_t x, int32_t y)
+{
+    return drawString(string.c_str(), x, y, textfont);
+}
+
+int16_t TFT_eSPI::drawString(const String &string, int32_t x, int32_t y, uint8_t font)
+{
+    return drawString(string.c_str(), x, y, font);
+}
+
+int16_t TFT_eSPI::textWidth(const char *string)
+{
+    return textWidth(string, textfont);
+}
+
+int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
+{
+    // Smooth fonts, as the library measures them: advances, except that the
+    // last glyph counts up to its right edge
+    if (fontLoaded)
+    {
+        int16_t width = 0;
+        for (const char *p = string; *p; p++)
+        {
+            if (*p == ' ')
+            {
+                width += fontSpaceWidth;
+                continue;
+            }
+            const SmoothGlyph *g = findGlyph((uint8_t)*p);
+            if (!g)
+            {
+                width += fontSpaceWidth + 1;
+                continue;
+            }
+            if (width == 0 && g->dX < 0)
+                width -= g->dX;
+            width += p[1] ? g->xAdvance : g->dX + g->width;
+        }
+        return width;
+    }
+    return (int16_t)(strlen(string) * 6 * textsize * fontScale(font));
+}
+
+int16_t TFT_eSPI::fontHeight()
+{
+    return fontHeight(textfont);
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font)
+{
+    if (fontLoaded)
+        return fontYAdvance;
+    static const uint8_t heights[9] = {8, 8, 16, 8, 26, 8, 48, 48, 75};
+    if (font < 1 || font > 8)
+        font = 1;
+    return heights[font] * textsize;
+}
+
+size_t TFT_eSPI::write(uint8_t c)
+{
+    if (fontLoaded)
+    {
+        if (c != '\r')
+            drawGlyph(c);
+        return 1;
+    }
+
+    uint8_t size = textsize * fontScale(textfont);
+    if (c == '\n')
+    {
+        cursor_x = 0;
+        cursor_y += 8 * size;
+        return 1;
+    }
+    if (c == '\r')
+        return 1;
+    if (textwrapX && cursor_x + 6 * size > _width)
+    {
+        cursor_x = 0;
+        cursor_y += 8 * size;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, size);
+    cursor_x += 6 * size;
+    return 1;
+}
+
+// ============================================================================
+// SMOOTH FONTS
+// ============================================================================
+
+static int32_t readBE32(const uint8_t *p)
+{
+    return (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]);
+}
+
+// .vlw: a 24-byte header (glyph count, version, size, unused, ascent,
+// descent), 28 bytes of metrics per glyph, then the glyphs' 8-bit alpha
+// bitmaps in the same order. All values are big-endian.
+void TFT_eSPI::loadFont(const uint8_t array[])
+{
+    unloadFont();
+    uint16_t count = (uint16_t)readBE32(array);
+    fontAscent = (int16_t)readBE32(array + 16);
+    int16_t descent = (int16_t)readBE32(array + 20);
+    glyphs = (SmoothGlyph *)malloc((size_t)count * sizeof(SmoothGlyph));
+    if (!glyphs)
+        return;
+
+    // Guess at the space width, replaced by the font's own if it has one
+    fontSpaceWidth = (fontAscent + descent) * 2 / 7;
+    fontMaxAscent = fontAscent;
+    int16_t maxDescent = descent;
+    const uint8_t *metrics = array + 24;
+    const uint8_t *bitmap = metrics + (size_t)count * 28;
+    for (uint16_t i = 0; i < count; i++, metrics += 28)
+    {
+        SmoothGlyph &g = glyphs[i];
+        g.code = (uint16_t)readBE32(metrics);
+        g.height = (int16_t)readBE32(metrics + 4);
+        g.width = (int16_t)readBE32(metrics + 8);
+        g.xAdvance = (int16_t)readBE32(metrics + 12);
+        g.dY = (int16_t)readBE32(metrics + 16);
+        g.dX = (int16_t)readBE32(metrics + 20);
+        g.bitmap = bitmap;
+        bitmap += (size_t)g.width * g.height;
+
+        if (g.code == ' ')
+            fontSpaceWidth = g.xAdvance;
+        fontMaxAscent = max(fontMaxAscent, g.dY);
+        maxDescent = max(maxDescent, (int16_t)(g.height - g.dY));
+    }
+    glyphCount = count;
+    fontYAdvance = fontMaxAscent + maxDescent;
+    fontLoaded = true;
+}
+
+void TFT_eSPI::unloadFont()
+{
+    free(glyphs);
+    glyphs = nullptr;
+    glyphCount = 0;
+    fontLoaded = false;
+}
+
+const TFT_eSPI::SmoothGlyph *TFT_eSPI::findGlyph(uint16_t code)
+{
+    for (uint16_t i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].code == code)
+            return &glyphs[i];
+    }
+    return nullptr;
+}
+
+// The library's drawGlyph(): each run of opaque pixels as a line, each edge
+// pixel blended with the background colour (read back from the panel when
+// no background is set) and drawn on its own
+void TFT_eSPI::drawGlyph(uint16_t code)
+{
+    if (code == '\n')
+    {
+        cursor_x = 0;
+        cursor_y += fontYAdvance;
+        return;
+    }
+    if (code == ' ')
+    {
+        cursor_x += fontSpaceWidth;
+        return;
+    }
+
+    const SmoothGlyph *g = findGlyph(code);
+    if (!g)
+    {
+        drawRect(cursor_x, cursor_y + fontMaxAscent - fontAscent, fontSpaceWidth, fontAscent, textcolor);
+        cursor_x += fontSpaceWidth + 1;
+        return;
+    }
+
+    if (textwrapX && cursor_x + g->width + g->dX > width())
+    {
+        cursor_y += fontYAdvance;
+        cursor_x = 0;
+    }
+    if (cursor_x == 0)
+        cursor_x -= g->dX;
+
+    int32_t cy = cursor_y + fontMaxAscent - g->dY;
+    int32_t cx = cursor_x + g->dX;
+    uint16_t fg = textcolor;
+    bool readBg = textcolor == textbgcolor;
+    startWrite();
+    for (int32_t y = 0; y < g->height; y++)
+    {
+        const uint8_t *row = g->bitmap + y * g->width;
+        int32_t runStart = 0, run = 0;
+        for (int32_t x = 0; x < g->width; x++)
+        {
+            uint8_t alpha = row[x];
+            if (alpha == 0xFF)
+            {
+                if (run == 0)
+                    runStart = x;
+                run++;
+                continue;
+            }
+            if (run)
+            {
+                drawFastHLine(cx + runStart, cy + y, run, fg);
+                run = 0;
+            }
+            if (alpha)
+            {
+                uint16_t bg = readBg ? readPixel(cx + x, cy + y) : (uint16_t)textbgcolor;
+                drawPixel(cx + x, cy + y, alphaBlend(alpha, fg, bg));
+            }
+        }
+        if (run)
+            drawFastHLine(cx + runStart, cy + y, run, fg);
+    }
+    endWrite();
+    cursor_x += g->xAdvance;
+}
@@ -0,0 +1,217 @@
+/*
+ * Host stand-in for TFT_eSPI (ILI9341, 4-wire SPI)
+ *
+ * Drawing calls update the simulated panel GRAM and charge the simulated
+ * display bus with the bytes TFT_eSPI would clock out: an address window
+ * (CASET/RASET/RAMWR) per transfer plus 2 bytes per pixel, or 3 bytes per
+ * pixel at SPI_READ_FREQUENCY for reads. Byte order follows the library:
+ * pushImage() sends native uint16_t data as-is when setSwapBytes(true) and
+ * byte-swapped otherwise, readRect() returns byte-swapped colours.
+ *
+ * Text uses a 6x8 GLCD cell with placeholder glyph bitmaps; the bus cost per
+ * character matches the library, the shapes do not. Smooth fonts are real:
+ * loadFont() parses .vlw data and glyphs are drawn with the library's
+ * transfer pattern (ASCII only, no UTF-8 decoding).
+ */
+
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+#include "Arduino.h"
+#include "SPI.h"
+
+// ============================================================================
+// COLOURS AND DATUMS
+// ============================================================================
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKCYAN 0x03EF
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK 0xFE19
+#define TFT_BROWN 0x9A60
+#define TFT_GOLD 0xFEA0
+#define TFT_SILVER 0xC618
+#define TFT_SKYBLUE 0x867D
+#define TFT_VIOLET 0x915C
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+
+#define TFT_CASET 0x2A
+#define TFT_PASET 0x2B
+#define TFT_RAMWR 0x2C
+#define TFT_INVOFF 0x20
+#define TFT_INVON 0x21
+
+// ============================================================================
+// TFT_eSPI
+// ============================================================================
+
+class TFT_eSPI : public Print
+{
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+
+    void init(uint8_t tc = 0);
+    void begin(uint8_t tc = 0) { init(tc); }
+    void setRotation(uint8_t r);
+    uint8_t getRotation() { return rotation; }
+    int16_t width() { return _vpDatum ? _vpW : _width; }
+    int16_t height() { return _vpDatum ? _vpH : _height; }
+    void invertDisplay(bool i);
+
+    void writecommand(uint8_t c);
+    void writedata(uint8_t d);
+    void startWrite();
+    void endWrite();
+    static SPIClass &getSPIinstance();
+
+    // Raw window access
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void pushColor(uint16_t color);
+    void pushColor(uint16_t color, uint32_t len);
+    void pushColors(uint16_t *data, uint32_t len, bool swap = true);
+    void pushPixels(const void *data, uint32_t len);
+    void pushBlock(uint16_t color, uint32_t len);
+
+    // Viewport: clips all drawing, and with vpDatum makes it the origin
+    void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+    void resetViewport();
+
+    // Primitives
+    void drawPixel(int32_t x, int32_t y, uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    void fillScreen(uint32_t color);
+
+    // Images
+    void setSwapBytes(bool swap) { _swapBytes = swap; }
+    bool getSwapBytes() { return _swapBytes; }
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t transparent);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent);
+    void pushRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+    void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+    uint16_t readPixel(int32_t x, int32_t y);
+
+    // DMA (the transfer overlaps CPU work until dmaWait() or the next bus use)
+    bool initDMA(bool ctrl_cs = false);
+    void deInitDMA();
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = nullptr);
+    void pushPixelsDMA(uint16_t *image, uint32_t len);
+    bool dmaBusy();
+    void dmaWait();
+
+    // Colour helpers
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
+
+    // Text
+    void setTextColor(uint16_t color);
+    void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+    void setTextSize(uint8_t size);
+    void setTextFont(uint8_t font);
+    void setTextDatum(uint8_t datum);
+    void setTextWrap(bool wrapX, bool wrapY = false);
+    void setCursor(int16_t x, int16_t y);
+    void setCursor(int16_t x, int16_t y, uint8_t font);
+    int16_t getCursorX() { return cursor_x; }
+    int16_t getCursorY() { return cursor_y; }
+    void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+    int16_t drawString(const char *string, int32_t x, int32_t y);
+    int16_t drawString(const char *string, int32_t x, int32_t y, uint8_t font);
+    int16_t drawString(const String &string, int32_t x, int32_t y);
+    int16_t drawString(const String &string, int32_t x, int32_t y, uint8_t font);
+    int16_t textWidth(const char *string);
+    int16_t textWidth(const char *string, uint8_t font);
+    int16_t fontHeight();
+    int16_t fontHeight(int16_t font);
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    // Smooth fonts (.vlw data, kept in place while loaded)
+    void loadFont(const uint8_t array[]);
+    void unloadFont();
+    bool fontLoaded = false;
+
+protected:
+    int32_t _init_width, _init_height;
+    int32_t _width, _height;
+    uint8_t rotation;
+    bool _swapBytes;
+    int32_t _vpX, _vpY, _vpW, _vpH;
+    bool _vpDatum;
+
+    int16_t cursor_x, cursor_y;
+    uint32_t textcolor, textbgcolor;
+    uint8_t textsize, textfont, textdatum;
+    bool textwrapX;
+
+private:
+    struct DmaJob
+    {
+        bool active;
+        int32_t x0, y0, x1, y1;
+        const uint16_t *data;
+        uint32_t len;
+    };
+
+    void panelWrite(int32_t x, int32_t y, uint16_t color);
+    uint16_t panelRead(int32_t x, int32_t y);
+    void windowWrite(uint16_t color);
+    void finishDma();
+    bool clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h, int32_t &dx, int32_t &dy);
+    void pushImageRows(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, bool swap);
+    void pushImageTransparent(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent);
+    uint8_t fontScale(uint8_t font);
+
+    struct SmoothGlyph
+    {
+        uint16_t code;
+        int16_t width, height, xAdvance, dY, dX;
+        const uint8_t *bitmap;
+    };
+    const SmoothGlyph *findGlyph(uint16_t code);
+    void drawGlyph(uint16_t code);
+
+    SmoothGlyph *glyphs = nullptr;
+    uint16_t glyphCount = 0;
+    int16_t fontYAdvance = 0, fontAscent = 0, fontMaxAscent = 0, fontSpaceWidth = 0;
+
+    int32_t winX0, winY0, winX1, winY1, winX, winY;
+    bool inTransaction;
+    bool dmaReady;
+    DmaJob dmaJob;
+};
+
+#endif // HOST_TFT_ESPI_H
@@ -0,0 +1,27 @@
+/*
+ * Host stand-in for the ESP-IDF GPIO driver (driver/gpio.h)
+ *
+ * Levels go to the simulator's GPIO table, as digitalWrite() does.
+ */
+
+#ifndef HOST_DRIVER_GPIO_H
+#define HOST_DRIVER_GPIO_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "HostSim.h"
+
+typedef int gpio_num_t;
+
+inline esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+    hostSimGpioWrite((uint8_t)pin, level ? 1 : 0);
+    return ESP_OK;
+}
+
+inline int gpio_get_level(gpio_num_t pin)
+{
+    return hostSimGpioRead((uint8_t)pin);
+}
+
+#endif // HOST_DRIVER_GPIO_H
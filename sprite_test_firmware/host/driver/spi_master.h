@@ -0,0 +1,87 @@
+/*
+ * Host stand-in for the ESP-IDF SPI master driver (driver/spi_master.h)
+ *
+ * Devices added to the display host queue transactions on the simulated
+ * display bus: each one is an async transfer that pays the DMA queue setup,
+ * so the CPU runs on until spi_device_get_trans_result() waits for it. The
+ * device's pre_cb runs at queue time and the level it leaves on the DC pin
+ * (HOST_TFT_DC) decides whether the bytes reach the panel as a command or
+ * as parameters/pixels. Like the DMA model in TFT_eSPI, buffers are read
+ * only when the result is collected.
+ *
+ * Only the fields and calls the firmware uses are modeled: no receive
+ * phase, no command/address phases, no polling transactions.
+ */
+
+#ifndef HOST_DRIVER_SPI_MASTER_H
+#define HOST_DRIVER_SPI_MASTER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef enum
+{
+    SPI1_HOST = 0,
+    SPI2_HOST = 1,
+    SPI3_HOST = 2,
+} spi_host_device_t;
+
+#define HSPI_HOST SPI2_HOST
+#define VSPI_HOST SPI3_HOST
+
+#define SPI_DEVICE_NO_DUMMY (1 << 6)
+#define SPI_TRANS_USE_RXDATA (1 << 2)
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+
+struct spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t *trans);
+
+typedef struct
+{
+    uint8_t command_bits;
+    uint8_t address_bits;
+    uint8_t dummy_bits;
+    uint8_t mode;
+    uint16_t duty_cycle_pos;
+    uint16_t cs_ena_pretrans;
+    uint8_t cs_ena_posttrans;
+    int clock_speed_hz;
+    int input_delay_ns;
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+    transaction_cb_t pre_cb;
+    transaction_cb_t post_cb;
+} spi_device_interface_config_t;
+
+struct spi_transaction_t
+{
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+    size_t length;   // bits
+    size_t rxlength; // bits
+    void *user;
+    union
+    {
+        const void *tx_buffer;
+        uint8_t tx_data[4];
+    };
+    union
+    {
+        void *rx_buffer;
+        uint8_t rx_data[4];
+    };
+};
+
+typedef struct HostSpiDevice *spi_device_handle_t;
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t *trans, TickType_t ticksToWait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t **trans, TickType_t ticksToWait);
+
+#endif // HOST_DRIVER_SPI_MASTER_H
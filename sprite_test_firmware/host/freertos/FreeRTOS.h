@@ -0,0 +1,27 @@
+/*
+ * Host stand-in for the ESP-IDF FreeRTOS configuration header
+ *
+ * Types and constants only; tasks are in freertos/task.h.
+ */
+
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+
+// Arduino-ESP32 runs the tick at 1 kHz
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) * configTICK_RATE_HZ / 1000)
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+
+#endif // HOST_FREERTOS_H
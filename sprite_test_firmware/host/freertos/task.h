@@ -0,0 +1,37 @@
+/*
+ * Host stand-in for FreeRTOS tasks
+ *
+ * Each task is a std::thread that reports the core it was pinned to through
+ * xPortGetCoreID(); the main thread is the Arduino loop task on core 1.
+ * While any task runs the simulator is in real-time mode (see HostSim.h).
+ * Only vTaskDelete(NULL), a task ending itself, is supported.
+ *
+ * Direct-to-task notifications are counting semaphores on a condition
+ * variable. A task blocked without a timeout doesn't hold the simulator in
+ * real-time mode; the notification that wakes it puts it back.
+ */
+
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void *);
+typedef struct HostTask *TaskHandle_t;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *createdTask,
+                                   BaseType_t coreId);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xPortGetCoreID();
+void hostTaskYield();
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken);
+
+#define taskYIELD() hostTaskYield()
+#define portYIELD_FROM_ISR(...) hostTaskYield()
+
+#endif // HOST_FREERTOS_TASK_H
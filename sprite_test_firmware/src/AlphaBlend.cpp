@@ -0,0 +1,92 @@
+/*
+ * Per-pixel alpha blending of RGB565 sprites into RAM buffers
+ *
+ * Kept free of Arduino dependencies for the host microbenchmark
+ * (bench/alpha_blend_bench.cpp).
+ */
+
+#include "AlphaSprite.h"
+
+// 4-bit alpha to the blend's 0..32, rounded
+static const uint8_t alpha4To32[16] = {0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32};
+
+static inline uint16_t swap16(uint16_t c)
+{
+    return (c << 8) | (c >> 8);
+}
+
+// Sprites are mostly fully transparent or fully opaque, so those two skip
+// the blend
+template <bool Swapped>
+static inline void blendPixel(uint16_t &dest, uint16_t fg, uint32_t alpha)
+{
+    if (alpha == 0)
+        return;
+    if (alpha >= 32)
+        dest = Swapped ? swap16(fg) : fg;
+    else if (Swapped)
+        dest = swap16(alphaBlend565(fg, swap16(dest), alpha));
+    else
+        dest = alphaBlend565(fg, dest, alpha);
+}
+
+template <bool Swapped>
+static void blendRow8(uint16_t *dest, const uint16_t *src, const uint8_t *alpha8, int count)
+{
+    for (int i = 0; i < count; i++)
+        blendPixel<Swapped>(dest[i], src[i], (alpha8[i] + 4) >> 3);
+}
+
+template <bool Swapped>
+static void blendRow4(uint16_t *dest, const uint16_t *src, const uint8_t *alpha4, int first, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        int n = first + i;
+        uint8_t a = (alpha4[n >> 1] >> ((n & 1) << 2)) & 0x0F;
+        blendPixel<Swapped>(dest[i], src[i], alpha4To32[a]);
+    }
+}
+
+void alphaBlendRow8(uint16_t *dest, const uint16_t *src, const uint8_t *alpha8, int count)
+{
+    blendRow8<false>(dest, src, alpha8, count);
+}
+
+void alphaBlendRow4(uint16_t *dest, const uint16_t *src, const uint8_t *alpha4, int first, int count)
+{
+    blendRow4<false>(dest, src, alpha4, first, count);
+}
+
+template <bool Swapped>
+static void blendSprite(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                        const AlphaSprite &sprite)
+{
+    int32_t left = x < 0 ? -x : 0;
+    int32_t top = y < 0 ? -y : 0;
+    int32_t right = x + sprite.width > destW ? destW - x : sprite.width;
+    int32_t bottom = y + sprite.height > destH ? destH - y : sprite.height;
+    if (right <= left || bottom <= top)
+        return;
+
+    int32_t alphaPitch = sprite.alphaBits == 8 ? sprite.width : (sprite.width + 1) / 2;
+    for (int32_t row = top; row < bottom; row++)
+    {
+        uint16_t *out = dest + (y + row) * destW + x + left;
+        const uint16_t *src = sprite.pixels + row * sprite.width + left;
+        const uint8_t *alpha = sprite.alpha + row * alphaPitch;
+        if (sprite.alphaBits == 8)
+            blendRow8<Swapped>(out, src, alpha + left, right - left);
+        else
+            blendRow4<Swapped>(out, src, alpha, left, right - left);
+    }
+}
+
+void blendAlphaSprite(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                      const AlphaSprite &sprite, bool swapped)
+{
+    if (swapped)
+        blendSprite<true>(dest, destW, destH, x, y, sprite);
+    else
+        blendSprite<false>(dest, destW, destH, x, y, sprite);
+}
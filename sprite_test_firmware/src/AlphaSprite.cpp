@@ -0,0 +1,132 @@
+/*
+ * Per-pixel alpha sprites: loading from SD
+ */
+
+#include "AlphaSprite.h"
+#include <SD.h>
+
+#define A565_HEADER_BYTES 10
+
+static size_t alphaPlaneBytes(int16_t width, int16_t height, uint8_t alphaBits)
+{
+    return alphaBits == 8 ? (size_t)width * height : (size_t)((width + 1) / 2) * height;
+}
+
+bool loadAlphaSpriteFromSD(const char *filepath, AlphaSprite &sprite)
+{
+    sprite.width = sprite.height = 0;
+    sprite.alphaBits = 0;
+    sprite.pixels = nullptr;
+    sprite.alpha = nullptr;
+
+    File file = SD.open(filepath);
+    if (!file)
+    {
+        Serial.print("Failed to open: ");
+        Serial.println(filepath);
+        return false;
+    }
+
+    uint8_t header[A565_HEADER_BYTES];
+    if (file.read(header, A565_HEADER_BYTES) != A565_HEADER_BYTES || memcmp(header, "A565", 4) != 0)
+    {
+        Serial.print("Not an alpha sprite: ");
+        Serial.println(filepath);
+        file.close();
+        return false;
+    }
+
+    int16_t width = header[4] | (header[5] << 8);
+    int16_t height = header[6] | (header[7] << 8);
+    uint8_t alphaBits = header[8];
+    size_t pixelBytes = (size_t)width * height * 2;
+    size_t alphaBytes = alphaPlaneBytes(width, height, alphaBits);
+    if (width <= 0 || height <= 0 || (alphaBits != 8 && alphaBits != 4) ||
+        file.size() != A565_HEADER_BYTES + pixelBytes + alphaBytes)
+    {
+        Serial.print("Bad alpha sprite header: ");
+        Serial.println(filepath);
+        file.close();
+        return false;
+    }
+
+    uint8_t *block = (uint8_t *)malloc(pixelBytes + alphaBytes);
+    if (!block)
+    {
+        Serial.println("Alpha sprite allocation failed!");
+        file.close();
+        return false;
+    }
+
+    size_t bytesRead = file.read(block, pixelBytes + alphaBytes);
+    file.close();
+    if (bytesRead != pixelBytes + alphaBytes)
+    {
+        free(block);
+        return false;
+    }
+
+    sprite.width = width;
+    sprite.height = height;
+    sprite.alphaBits = alphaBits;
+    sprite.pixels = (uint16_t *)block;
+    sprite.alpha = block + pixelBytes;
+
+    Serial.print("Loaded ");
+    Serial.print(width);
+    Serial.print("x");
+    Serial.print(height);
+    Serial.print(" sprite with ");
+    Serial.print(alphaBits);
+    Serial.print("-bit alpha from ");
+    Serial.println(filepath);
+    return true;
+}
+
+bool mirrorAlphaSprite(const AlphaSprite &sprite, AlphaSprite &mirrored)
+{
+    size_t pixelBytes = (size_t)sprite.width * sprite.height * 2;
+    size_t alphaBytes = alphaPlaneBytes(sprite.width, sprite.height, sprite.alphaBits);
+    uint8_t *block = (uint8_t *)malloc(pixelBytes + alphaBytes);
+    if (!block)
+    {
+        Serial.println("Alpha sprite allocation failed!");
+        mirrored.pixels = nullptr;
+        mirrored.alpha = nullptr;
+        return false;
+    }
+
+    mirrored.width = sprite.width;
+    mirrored.height = sprite.height;
+    mirrored.alphaBits = sprite.alphaBits;
+    mirrored.pixels = (uint16_t *)block;
+    mirrored.alpha = block + pixelBytes;
+    memset(mirrored.alpha, 0, alphaBytes);
+
+    int32_t w = sprite.width;
+    int32_t pitch = sprite.alphaBits == 8 ? w : (w + 1) / 2;
+    for (int32_t y = 0; y < sprite.height; y++)
+    {
+        const uint16_t *src = sprite.pixels + y * w;
+        uint16_t *dst = mirrored.pixels + y * w;
+        const uint8_t *srcAlpha = sprite.alpha + y * pitch;
+        uint8_t *dstAlpha = mirrored.alpha + y * pitch;
+        for (int32_t x = 0; x < w; x++)
+        {
+            int32_t from = w - 1 - x;
+            dst[x] = src[from];
+            if (sprite.alphaBits == 8)
+                dstAlpha[x] = srcAlpha[from];
+            else
+                dstAlpha[x / 2] |= ((srcAlpha[from / 2] >> ((from & 1) * 4)) & 0x0F) << ((x & 1) * 4);
+        }
+    }
+    return true;
+}
+
+void freeAlphaSprite(AlphaSprite &sprite)
+{
+    free(sprite.pixels);
+    sprite.pixels = nullptr;
+    sprite.alpha = nullptr;
+}
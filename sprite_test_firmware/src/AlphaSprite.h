@@ -0,0 +1,59 @@
+/*
+ * Sprites with per-pixel alpha, blended into RAM over any background
+ *
+ * The PNG loader flattens alpha onto black and the .rle565 format keeps
+ * only a cut-off, so the soft edges of a sprite come out dark over a
+ * coloured background. Here an RGB565 image carries a separate 8-bit or
+ * 4-bit alpha plane and is blended into a RAM buffer (a compositor band or
+ * a TFT_eSprite), where the background is already known.
+ * Files are produced by tools/png_to_a565.py.
+ *
+ * The blend works on all three channels at once: the pixel is spread over
+ * a 32-bit word with green in the top half and red and blue in the bottom
+ * (mask 0x07E0F81F), leaving room between the fields for one multiply by a
+ * 5-bit alpha.
+ */
+
+#ifndef ALPHA_SPRITE_H
+#define ALPHA_SPRITE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct AlphaSprite
+{
+    int16_t width, height;
+    uint8_t alphaBits;    // 8: a byte per pixel, 4: two pixels per byte, low nibble first
+    uint16_t *pixels;     // RGB565, not premultiplied
+    uint8_t *alpha;       // rows of width bytes (8-bit) or (width + 1) / 2 bytes (4-bit)
+};
+
+// Loads a .a565 file into one malloc'd block. Returns false on any error.
+bool loadAlphaSpriteFromSD(const char *filepath, AlphaSprite &sprite);
+void freeAlphaSprite(AlphaSprite &sprite);
+
+// Copies sprite flipped left to right into its own block, for sprites
+// drawn facing the other way. Free with freeAlphaSprite().
+bool mirrorAlphaSprite(const AlphaSprite &sprite, AlphaSprite &mirrored);
+
+// fg over bg with alpha from 0 (bg) to 32 (fg)
+static inline uint16_t alphaBlend565(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t mix = ((((f - b) * alpha) >> 5) + b) & 0x07E0F81F;
+    return (uint16_t)(mix | (mix >> 16));
+}
+
+// Blends count pixels of src into dest. alpha8 holds a byte per pixel;
+// alpha4 holds nibbles starting at nibble first (0 = low nibble of byte 0).
+void alphaBlendRow8(uint16_t *dest, const uint16_t *src, const uint8_t *alpha8, int count);
+void alphaBlendRow4(uint16_t *dest, const uint16_t *src, const uint8_t *alpha4, int first, int count);
+
+// Blends the sprite with its top-left corner at (x, y) into a destW x
+// destH RGB565 buffer, clipped to it. swapped is for buffers holding
+// byte-swapped colours, as a 16-bit TFT_eSprite does (getPointer()).
+void blendAlphaSprite(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                      const AlphaSprite &sprite, bool swapped = false);
+
+#endif // ALPHA_SPRITE_H
@@ -0,0 +1,169 @@
+/*
+ * Frame-sequence sprite animation
+ */
+
+#include "Animation.h"
+
+const AnimClip *findClip(const AnimClip *clips, int count, const char *name)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (strcmp(clips[i].name, name) == 0)
+            return &clips[i];
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// SHEET
+// ============================================================================
+
+bool AnimSheet::loadFromAtlas(SpriteAtlas &atlas, const char *name, int16_t frameW, int16_t frameH)
+{
+    end();
+
+    const AtlasEntry *entry = atlas.find(name, ATLAS_RGB565);
+    if (!entry)
+    {
+        Serial.print("Not in atlas: ");
+        Serial.println(name);
+        return false;
+    }
+    if (entry->width != frameW || frameH <= 0 || entry->height % frameH != 0 ||
+        entry->height / frameH > ANIM_MAX_FRAMES)
+    {
+        Serial.print("Not a sheet of ");
+        Serial.print(frameW);
+        Serial.print("x");
+        Serial.print(frameH);
+        Serial.print(" frames: ");
+        Serial.println(name);
+        return false;
+    }
+    size_t expectedSize = (size_t)entry->width * entry->height * 2;
+    if (entry->size != expectedSize)
+    {
+        Serial.print("Size mismatch: ");
+        Serial.print(entry->size);
+        Serial.print(" vs ");
+        Serial.println(expectedSize);
+        return false;
+    }
+
+    pixels = (uint16_t *)malloc(entry->size);
+    if (!pixels || !atlas.read(*entry, pixels, entry->size))
+    {
+        Serial.println("Sheet load failed!");
+        end();
+        return false;
+    }
+
+    // Frames are stacked, so each starts a whole frame further on
+    count = entry->height / frameH;
+    for (uint8_t i = 0; i < count; i++)
+        frames[i] = pixels + (size_t)i * frameW * frameH;
+    this->frameW = frameW;
+    this->frameH = frameH;
+    return true;
+}
+
+void AnimSheet::end()
+{
+    free(pixels);
+    pixels = nullptr;
+    count = 0;
+}
+
+// ============================================================================
+// PLAYBACK
+// ============================================================================
+
+void Animator::play(const AnimClip *newClip, uint32_t startMs)
+{
+    clip = newClip;
+    step = 0;
+    direction = 1;
+    elapsedMs = 0;
+    finished = false;
+
+    // One full pass: ping-pong plays the end frames once per cycle and
+    // the ones in between twice
+    cycleMs = 0;
+    if (clip->mode != ANIM_ONCE)
+    {
+        for (uint8_t i = 0; i < clip->count; i++)
+        {
+            bool inner = clip->mode == ANIM_PING_PONG && i > 0 && i + 1 < clip->count;
+            cycleMs += clip->frames[i].durationMs * (inner ? 2 : 1);
+        }
+    }
+    update(startMs);
+}
+
+// Moves to the next step; false once an ANIM_ONCE clip has ended
+bool Animator::advance()
+{
+    switch (clip->mode)
+    {
+    case ANIM_LOOP:
+        step = step + 1 < clip->count ? step + 1 : 0;
+        return true;
+    case ANIM_PING_PONG:
+        if (clip->count > 1)
+        {
+            if (step + direction < 0 || step + direction >= clip->count)
+                direction = -direction;
+            step += direction;
+        }
+        return true;
+    case ANIM_ONCE:
+    default:
+        if (step + 1 < clip->count)
+        {
+            step++;
+            return true;
+        }
+        finished = true;
+        return false;
+    }
+}
+
+bool Animator::update(uint32_t dtMs)
+{
+    if (!clip || finished || clip->count == 0)
+        return false;
+
+    // Whole cycles change nothing, so a long stall costs one pass at most
+    uint32_t t = elapsedMs + dtMs;
+    if (cycleMs && t >= cycleMs)
+        t %= cycleMs;
+
+    bool changed = false;
+    for (;;)
+    {
+        // A zero duration still shows the frame for a millisecond
+        uint16_t duration = max(clip->frames[step].durationMs, (uint16_t)1);
+        if (t < duration)
+            break;
+        t -= duration;
+        if (!advance())
+        {
+            t = 0;
+            break;
+        }
+        changed = true;
+    }
+    elapsedMs = t;
+    return changed;
+}
+
+int updateAnimators(Animator *animators, int count, uint32_t dtMs)
+{
+    int changed = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (animators[i].update(dtMs))
+            changed++;
+    }
+    return changed;
+}
@@ -0,0 +1,95 @@
+/*
+ * Frame-sequence sprite animation over an atlas sheet
+ *
+ * All frames of a sprite live in one sheet: equally sized RGB565 frames
+ * stacked top to bottom (tools/make_sheet.py), stored in the atlas as one
+ * raw entry and read once. Each frame is then contiguous, so drawing one is
+ * a pushImage() from a pointer in a table built at load time; switching
+ * frames never touches the SD card or copies pixels.
+ *
+ * A clip names a sequence of sheet frames with a duration each, played
+ * looped, back and forth, or once. Animators hold the playback state of
+ * one sprite and all advance from the same frame delta.
+ */
+
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <Arduino.h>
+#include "SpriteAtlas.h"
+
+#define ANIM_MAX_FRAMES 32
+
+enum AnimMode : uint8_t
+{
+    ANIM_LOOP,      // 0 1 2 3 0 1 2 3 ...
+    ANIM_PING_PONG, // 0 1 2 3 2 1 0 1 ...
+    ANIM_ONCE       // 0 1 2 3, then holds the last frame
+};
+
+struct AnimFrame
+{
+    uint8_t index;       // frame in the sheet
+    uint16_t durationMs;
+};
+
+struct AnimClip
+{
+    const char *name;
+    const AnimFrame *frames;
+    uint8_t count;
+    AnimMode mode;
+};
+
+// Looks a clip up by name; nullptr if there is none
+const AnimClip *findClip(const AnimClip *clips, int count, const char *name);
+
+class AnimSheet
+{
+public:
+    ~AnimSheet() { end(); }
+
+    // Reads the raw RGB565 atlas entry `name` and splits it into frames of
+    // frameW x frameH. Returns false on any error.
+    bool loadFromAtlas(SpriteAtlas &atlas, const char *name, int16_t frameW, int16_t frameH);
+    void end();
+
+    // nullptr past the last frame of the sheet
+    const uint16_t *frame(uint8_t index) const { return index < count ? frames[index] : nullptr; }
+    uint8_t frameCount() const { return count; }
+    int16_t frameWidth() const { return frameW; }
+    int16_t frameHeight() const { return frameH; }
+
+private:
+    uint16_t *pixels = nullptr;
+    const uint16_t *frames[ANIM_MAX_FRAMES] = {};
+    uint8_t count = 0;
+    int16_t frameW = 0, frameH = 0;
+};
+
+struct Animator
+{
+    const AnimClip *clip = nullptr;
+    uint32_t cycleMs = 0;   // time until the clip repeats exactly (0 for ANIM_ONCE)
+    uint16_t elapsedMs = 0; // into the current step
+    uint8_t step = 0;
+    int8_t direction = 1;
+    bool finished = false;
+
+    // Starts the clip from its first frame, startMs into it
+    void play(const AnimClip *newClip, uint32_t startMs = 0);
+
+    // Advances by dtMs. Returns true if the frame shown changed.
+    bool update(uint32_t dtMs);
+
+    uint8_t frame() const { return clip->frames[step].index; }
+
+private:
+    bool advance();
+};
+
+// Advances every animator by the same frame delta. Returns how many
+// changed frame.
+int updateAnimators(Animator *animators, int count, uint32_t dtMs);
+
+#endif // ANIMATION_H
@@ -0,0 +1,153 @@
+/*
+ * Budgeted LRU asset cache
+ */
+
+#include "AssetCache.h"
+
+void AssetCache::begin(size_t budgetBytes, AssetLoader loader)
+{
+    for (int i = 0; i < MAX_ENTRIES; i++)
+    {
+        if (entries[i].data)
+            release(entries[i]);
+    }
+    load = loader;
+    useClock = 0;
+    stats = {0, 0, 0, 0, 0, budgetBytes};
+}
+
+AssetCache::Entry *AssetCache::find(const char *path)
+{
+    for (int i = 0; i < MAX_ENTRIES; i++)
+    {
+        if (entries[i].data && strcmp(entries[i].path, path) == 0)
+            return &entries[i];
+    }
+    return nullptr;
+}
+
+void AssetCache::release(Entry &e)
+{
+    free(e.data);
+    stats.bytesUsed -= e.bytes;
+    e.data = nullptr;
+    e.bytes = 0;
+    e.pins = 0;
+}
+
+// Frees the least recently used unpinned asset. Returns false if there is none.
+bool AssetCache::evictOne()
+{
+    Entry *victim = nullptr;
+    for (int i = 0; i < MAX_ENTRIES; i++)
+    {
+        Entry &e = entries[i];
+        if (e.data && e.pins == 0 && (!victim || e.lastUse < victim->lastUse))
+            victim = &e;
+    }
+    if (!victim)
+        return false;
+
+    Serial.print("Cache evict: ");
+    Serial.println(victim->path);
+    release(*victim);
+    stats.evictions++;
+    return true;
+}
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+uint16_t *AssetCache::get(const char *path, size_t bytes)
+{
+    Entry *e = find(path);
+    if (e)
+    {
+        if (e->bytes != bytes)
+        {
+            stats.failures++;
+            return nullptr;
+        }
+        stats.hits++;
+        e->lastUse = ++useClock;
+        return e->data;
+    }
+
+    stats.misses++;
+    if (bytes > stats.budget || strlen(path) >= MAX_PATH)
+    {
+        stats.failures++;
+        return nullptr;
+    }
+
+    // Make room within the budget, then retry the allocation itself while
+    // fragmentation still leaves something to evict
+    while (stats.bytesUsed + bytes > stats.budget)
+    {
+        if (!evictOne())
+        {
+            stats.failures++;
+            return nullptr;
+        }
+    }
+    uint16_t *data = (uint16_t *)malloc(bytes);
+    while (!data && evictOne())
+    {
+        data = (uint16_t *)malloc(bytes);
+    }
+
+    Entry *slot = nullptr;
+    for (int i = 0; i < MAX_ENTRIES && !slot; i++)
+    {
+        if (!entries[i].data)
+            slot = &entries[i];
+    }
+    if (!slot && data && evictOne())
+    {
+        for (int i = 0; i < MAX_ENTRIES && !slot; i++)
+        {
+            if (!entries[i].data)
+                slot = &entries[i];
+        }
+    }
+
+    if (!data || !slot || !load(path, data, bytes))
+    {
+        free(data);
+        stats.failures++;
+        return nullptr;
+    }
+
+    strcpy(slot->path, path);
+    slot->data = data;
+    slot->bytes = bytes;
+    slot->pins = 0;
+    slot->lastUse = ++useClock;
+    stats.bytesUsed += bytes;
+    return data;
+}
+
+uint16_t *AssetCache::pin(const char *path, size_t bytes)
+{
+    uint16_t *data = get(path, bytes);
+    if (data)
+        find(path)->pins++;
+    return data;
+}
+
+void AssetCache::unpin(const char *path)
+{
+    Entry *e = find(path);
+    if (e && e->pins > 0)
+        e->pins--;
+}
+
+void AssetCache::flush()
+{
+    for (int i = 0; i < MAX_ENTRIES; i++)
+    {
+        if (entries[i].data && entries[i].pins == 0)
+            release(entries[i]);
+    }
+}
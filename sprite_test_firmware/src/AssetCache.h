@@ -0,0 +1,70 @@
+/*
+ * Budgeted LRU cache for RGB565 assets loaded from SD
+ *
+ * Assets are keyed by path and loaded on first use. The cache never holds
+ * more than its byte budget (taken from the free heap at boot); when a new
+ * asset does not fit, the least recently used unpinned assets are freed.
+ * Pin an asset while its pointer is in use so it cannot be evicted.
+ */
+
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <Arduino.h>
+
+// Reads exactly `bytes` of the file at `path` into `buffer`
+typedef bool (*AssetLoader)(const char *path, uint16_t *buffer, size_t bytes);
+
+struct AssetCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t failures; // load errors, or no room even after evicting
+    size_t bytesUsed;
+    size_t budget;
+};
+
+class AssetCache
+{
+public:
+    static const int MAX_ENTRIES = 16;
+    static const int MAX_PATH = 64;
+
+    void begin(size_t budgetBytes, AssetLoader loader);
+
+    // Returns the cached asset, loading it on a miss. nullptr on failure.
+    // The pointer stays valid until the asset is evicted, so pin it if
+    // other assets are loaded while it is in use.
+    uint16_t *get(const char *path, size_t bytes);
+
+    // get() plus a pin; every pin() needs a matching unpin()
+    uint16_t *pin(const char *path, size_t bytes);
+    void unpin(const char *path);
+
+    // Frees every unpinned asset
+    void flush();
+
+    AssetCacheStats getStats() const { return stats; }
+
+private:
+    struct Entry
+    {
+        char path[MAX_PATH];
+        uint16_t *data;
+        size_t bytes;
+        uint32_t lastUse;
+        uint16_t pins;
+    };
+
+    Entry *find(const char *path);
+    bool evictOne();
+    void release(Entry &e);
+
+    Entry entries[MAX_ENTRIES] = {};
+    AssetLoader load = nullptr;
+    uint32_t useClock = 0;
+    AssetCacheStats stats = {0, 0, 0, 0, 0, 0};
+};
+
+#endif // ASSET_CACHE_H
@@ -0,0 +1,130 @@
+/*
+ * Band compositor: RAM composition with double-buffered DMA pushes
+ */
+
+#include "BandCompositor.h"
+#include "SpriteTransform.h"
+
+// CASET/RASET/RAMWR sent ahead of every window
+#define WINDOW_SETUP_BYTES 11
+
+bool BandCompositor::begin(int16_t width, int16_t bandHeight)
+{
+    end();
+    bandW = width;
+    bandH = bandHeight;
+
+    // Plain malloc is internal DRAM on the CYD (no PSRAM), which DMA can read
+    size_t bytes = (size_t)width * bandHeight * 2;
+    bands[0] = (uint16_t *)malloc(bytes);
+    bands[1] = (uint16_t *)malloc(bytes);
+    if (!bands[0] || !bands[1])
+    {
+        end();
+        return false;
+    }
+    return true;
+}
+
+void BandCompositor::end()
+{
+    free(bands[0]);
+    free(bands[1]);
+    bands[0] = bands[1] = nullptr;
+}
+
+// ============================================================================
+// COMPOSITION
+// ============================================================================
+
+void BandCompositor::composeBand(uint16_t *band, int16_t top, int16_t rows,
+                                 const uint16_t *background,
+                                 const Sprite *sprites, int count,
+                                 const uint16_t *image, int16_t w, int16_t h)
+{
+    memcpy(band, background + (int32_t)top * bandW, (size_t)bandW * rows * 2);
+
+    for (int i = 0; i < count; i++)
+    {
+        const Sprite &s = sprites[i];
+        if (!s.active)
+            continue;
+
+        // Fish swimming left face left
+        if (s.dx < 0)
+        {
+            blitFlipped(band, bandW, rows, s.x, s.y - top, image, w, h);
+            continue;
+        }
+
+        // Sprite rows and columns that fall inside this band
+        int16_t y0 = max(s.y, top);
+        int16_t y1 = min(s.y + h, top + rows);
+        int16_t x0 = max(s.x, (int16_t)0);
+        int16_t x1 = min(s.x + w, (int)bandW);
+        if (y0 >= y1 || x0 >= x1)
+            continue;
+
+        size_t runBytes = (size_t)(x1 - x0) * 2;
+        for (int16_t y = y0; y < y1; y++)
+        {
+            memcpy(band + (int32_t)(y - top) * bandW + x0,
+                   image + (int32_t)(y - s.y) * w + (x0 - s.x),
+                   runBytes);
+        }
+    }
+}
+
+// ============================================================================
+// PUSH
+// ============================================================================
+
+// Runs compose(band, top, rows) for each band and pushes the result
+template <typename Compose>
+uint32_t BandCompositor::pushBands(TFT_eSPI &tft, int16_t x, int16_t y, int16_t height, Compose compose)
+{
+    uint32_t bytes = 0;
+    int next = 0;
+
+    for (int16_t top = 0; top < height; top += bandH)
+    {
+        int16_t rows = min(bandH, (int16_t)(height - top));
+        uint16_t *band = bands[next];
+
+        // pushImageDMA waits for the previous transfer before starting, so
+        // the buffer used two bands ago has always been sent by now
+        compose(band, top, rows);
+        tft.pushImageDMA(x, y + top, bandW, rows, band);
+
+        bytes += WINDOW_SETUP_BYTES + (uint32_t)bandW * rows * 2;
+        next ^= 1;
+    }
+    return bytes;
+}
+
+uint32_t BandCompositor::renderFrame(TFT_eSPI &tft, int16_t x, int16_t y,
+                                     const uint16_t *background, int16_t height,
+                                     const Sprite *sprites, int count,
+                                     const uint16_t *image, int16_t w, int16_t h)
+{
+    return pushBands(tft, x, y, height, [&](uint16_t *band, int16_t top, int16_t rows)
+                     { composeBand(band, top, rows, background, sprites, count, image, w, h); });
+}
+
+uint32_t BandCompositor::renderFrame(TFT_eSPI &tft, int16_t x, int16_t y,
+                                     const uint16_t *background, int16_t height,
+                                     const Sprite *sprites, int count, const AlphaSprite &image,
+                                     const AlphaSprite *mirrored)
+{
+    return pushBands(tft, x, y, height, [&](uint16_t *band, int16_t top, int16_t rows)
+                     {
+                         memcpy(band, background + (int32_t)top * bandW, (size_t)bandW * rows * 2);
+                         for (int i = 0; i < count; i++)
+                         {
+                             if (!sprites[i].active)
+                                 continue;
+                             const AlphaSprite &facing = mirrored && sprites[i].dx < 0 ? *mirrored : image;
+                             blendAlphaSprite(band, bandW, rows, sprites[i].x, sprites[i].y - top, facing);
+                         }
+                     });
+}
@@ -0,0 +1,55 @@
+/*
+ * Band compositor for background-plus-sprites scenes
+ *
+ * Instead of pushing the background and then overdrawing every sprite on
+ * the panel (flicker, and each sprite's area sent twice), the frame is built
+ * in RAM one horizontal band at a time: background rows are copied in, the
+ * sprites that cross the band are copied over them, and the finished band is
+ * sent with pushImageDMA. Two band buffers alternate so the CPU composes
+ * band N+1 while band N is still on the wire.
+ */
+
+#ifndef BAND_COMPOSITOR_H
+#define BAND_COMPOSITOR_H
+
+#include <TFT_eSPI.h>
+#include "Sprite.h"
+#include "AlphaSprite.h"
+
+class BandCompositor
+{
+public:
+    // Allocates two width x bandHeight buffers. Returns false if out of memory.
+    bool begin(int16_t width, int16_t bandHeight);
+    void end();
+
+    // Composes and pushes one width x height frame at (x, y). The caller
+    // holds the bus with startWrite() and DMA must be initialised; the last
+    // band is still in flight on return. Returns bytes sent.
+    uint32_t renderFrame(TFT_eSPI &tft, int16_t x, int16_t y,
+                         const uint16_t *background, int16_t height,
+                         const Sprite *sprites, int count,
+                         const uint16_t *image, int16_t w, int16_t h);
+
+    // Same, with the sprites alpha blended over the background. Sprites
+    // moving left are drawn from mirrored (mirrorAlphaSprite()) if given.
+    uint32_t renderFrame(TFT_eSPI &tft, int16_t x, int16_t y,
+                         const uint16_t *background, int16_t height,
+                         const Sprite *sprites, int count, const AlphaSprite &image,
+                         const AlphaSprite *mirrored = nullptr);
+
+    int16_t getBandHeight() const { return bandH; }
+
+private:
+    template <typename Compose>
+    uint32_t pushBands(TFT_eSPI &tft, int16_t x, int16_t y, int16_t height, Compose compose);
+    void composeBand(uint16_t *band, int16_t top, int16_t rows,
+                     const uint16_t *background,
+                     const Sprite *sprites, int count,
+                     const uint16_t *image, int16_t w, int16_t h);
+
+    uint16_t *bands[2] = {nullptr, nullptr};
+    int16_t bandW = 0, bandH = 0;
+};
+
+#endif // BAND_COMPOSITOR_H
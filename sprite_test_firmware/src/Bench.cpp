@@ -0,0 +1,190 @@
+/*
+ * Benchmark statistics and result output
+ */
+
+#include "Bench.h"
+#include <math.h>
+
+// ============================================================================
+// SAMPLES
+// ============================================================================
+
+BenchSampler::BenchSampler(size_t reserve)
+    : samples(nullptr), count(0), capacity(reserve > 0 ? reserve : 1)
+{
+    samples = (float *)malloc(capacity * sizeof(float));
+    if (!samples)
+        capacity = 0;
+}
+
+BenchSampler::~BenchSampler()
+{
+    free(samples);
+}
+
+void BenchSampler::add(float sample)
+{
+    if (count == capacity)
+    {
+        size_t grown = capacity ? capacity * 2 : 64;
+        float *bigger = (float *)realloc(samples, grown * sizeof(float));
+        if (!bigger)
+            return; // keep what we have rather than lose the run
+        samples = bigger;
+        capacity = grown;
+    }
+    samples[count++] = sample;
+}
+
+static int compareFloats(const void *a, const void *b)
+{
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// Linear interpolation between closest ranks
+static float percentile(const float *sorted, size_t n, float p)
+{
+    float rank = p * (n - 1);
+    size_t lo = (size_t)rank;
+    size_t hi = lo + 1 < n ? lo + 1 : lo;
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - lo);
+}
+
+BenchStats BenchSampler::stats() const
+{
+    BenchStats s = {0, 0, 0, 0, 0, 0, 0};
+    if (count == 0)
+        return s;
+
+    float *sorted = (float *)malloc(count * sizeof(float));
+    if (!sorted)
+        return s;
+    memcpy(sorted, samples, count * sizeof(float));
+    qsort(sorted, count, sizeof(float), compareFloats);
+
+    double sum = 0;
+    for (size_t i = 0; i < count; i++)
+        sum += sorted[i];
+    double mean = sum / count;
+    double var = 0;
+    for (size_t i = 0; i < count; i++)
+        var += (sorted[i] - mean) * (sorted[i] - mean);
+
+    s.n = count;
+    s.min = sorted[0];
+    s.median = percentile(sorted, count, 0.50f);
+    s.p95 = percentile(sorted, count, 0.95f);
+    s.p99 = percentile(sorted, count, 0.99f);
+    s.mean = mean;
+    s.stddev = count > 1 ? sqrt(var / (count - 1)) : 0;
+
+    free(sorted);
+    return s;
+}
+
+size_t BenchSampler::countAbove(float threshold) const
+{
+    size_t above = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (samples[i] > threshold)
+            above++;
+    }
+    return above;
+}
+
+BenchStats benchSingle(float value)
+{
+    return {1, value, value, value, value, value, 0};
+}
+
+// ============================================================================
+// RESULTS
+// ============================================================================
+
+static BenchFormat outputFormat = BENCH_FORMAT_CSV;
+static BenchResult *results = nullptr;
+static size_t resultCount = 0;
+static size_t resultCapacity = 0;
+
+void benchSetFormat(BenchFormat format)
+{
+    outputFormat = format;
+}
+
+void benchPrintMeta(const char *firmware)
+{
+    if (outputFormat == BENCH_FORMAT_JSON)
+    {
+        Serial.printf("{\"bench_meta\":{\"firmware\":\"%s\",\"build\":\"%s %s\",\"cpu_mhz\":%lu,\"spi_hz\":%lu,\"heap\":%lu}}\n",
+                      firmware, __DATE__, __TIME__, (unsigned long)ESP.getCpuFreqMHz(),
+                      (unsigned long)SPI_FREQUENCY, (unsigned long)ESP.getFreeHeap());
+    }
+    else
+    {
+        Serial.printf("BENCH_META,firmware=%s,build=%s %s,cpu_mhz=%lu,spi_hz=%lu,heap=%lu\n",
+                      firmware, __DATE__, __TIME__, (unsigned long)ESP.getCpuFreqMHz(),
+                      (unsigned long)SPI_FREQUENCY, (unsigned long)ESP.getFreeHeap());
+        Serial.println("BENCH,test,metric,unit,n,min,median,p95,p99,mean,stddev");
+    }
+}
+
+static void printResult(const BenchResult &r)
+{
+    const BenchStats &s = r.stats;
+    if (outputFormat == BENCH_FORMAT_JSON)
+    {
+        Serial.printf("{\"bench\":\"%s\",\"metric\":\"%s\",\"unit\":\"%s\",\"n\":%lu,"
+                      "\"min\":%.3f,\"median\":%.3f,\"p95\":%.3f,\"p99\":%.3f,\"mean\":%.3f,\"stddev\":%.3f}\n",
+                      r.test, r.metric, r.unit, (unsigned long)s.n,
+                      s.min, s.median, s.p95, s.p99, s.mean, s.stddev);
+    }
+    else
+    {
+        Serial.printf("BENCH,%s,%s,%s,%lu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                      r.test, r.metric, r.unit, (unsigned long)s.n,
+                      s.min, s.median, s.p95, s.p99, s.mean, s.stddev);
+    }
+}
+
+void benchRecord(const char *name, const char *unit, const BenchStats &stats)
+{
+    if (resultCount == resultCapacity)
+    {
+        size_t grown = resultCapacity ? resultCapacity * 2 : 32;
+        BenchResult *bigger = (BenchResult *)realloc(results, grown * sizeof(BenchResult));
+        if (!bigger)
+        {
+            Serial.println("benchRecord: out of memory, result dropped");
+            return;
+        }
+        results = bigger;
+        resultCapacity = grown;
+    }
+
+    BenchResult &r = results[resultCount++];
+    const char *split = strchr(name, '_');
+    size_t testLen = split ? (size_t)(split - name) : 0;
+    if (testLen >= sizeof(r.test))
+        testLen = 0;
+    memcpy(r.test, name, testLen);
+    r.test[testLen] = '\0';
+    strncpy(r.metric, testLen ? split + 1 : name, sizeof(r.metric) - 1);
+    r.metric[sizeof(r.metric) - 1] = '\0';
+    r.unit = unit;
+    r.stats = stats;
+
+    printResult(r);
+}
+
+size_t benchResultCount()
+{
+    return resultCount;
+}
+
+const BenchResult &benchResult(size_t i)
+{
+    return results[i];
+}
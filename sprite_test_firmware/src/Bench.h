@@ -0,0 +1,101 @@
+/*
+ * Benchmark harness: repeated measurements, summary statistics and
+ * machine-readable output
+ *
+ * A single average hides the one slow SD read or interrupt that skews it.
+ * Measurements here are kept as individual samples and summarised as
+ * min/median/p95/p99/mean/stddev. Every recorded result is also printed on
+ * Serial as one CSV or JSON line for tools/bench_report.py:
+ *
+ *   BENCH,<test>,<metric>,<unit>,<n>,<min>,<median>,<p95>,<p99>,<mean>,<stddev>
+ *   {"bench":"<test>","metric":"<metric>","unit":"<unit>","n":<n>,...}
+ *
+ * A BENCH_META line at startup identifies the board and firmware build.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <Arduino.h>
+
+enum BenchFormat
+{
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON
+};
+
+struct BenchStats
+{
+    uint32_t n;
+    float min, median, p95, p99, mean, stddev;
+};
+
+// Growable sample buffer. Reserve enough up front to keep allocation out of
+// timed loops; it doubles if a run goes longer.
+class BenchSampler
+{
+public:
+    explicit BenchSampler(size_t reserve = 64);
+    ~BenchSampler();
+
+    void add(float sample);
+    void clear() { count = 0; }
+    size_t size() const { return count; }
+    BenchStats stats() const;
+
+    // Samples strictly above threshold (e.g. frames over budget)
+    size_t countAbove(float threshold) const;
+
+private:
+    BenchSampler(const BenchSampler &) = delete;
+    BenchSampler &operator=(const BenchSampler &) = delete;
+
+    float *samples;
+    size_t count;
+    size_t capacity;
+};
+
+// Calls fn() warmup times untimed, then iterations times, each timed with
+// micros(). Returns per-call statistics in microseconds.
+template <typename F>
+BenchStats benchRun(int warmup, int iterations, F fn)
+{
+    for (int i = 0; i < warmup; i++)
+        fn();
+
+    BenchSampler sampler(iterations);
+    for (int i = 0; i < iterations; i++)
+    {
+        unsigned long start = micros();
+        fn();
+        sampler.add(micros() - start);
+    }
+    return sampler.stats();
+}
+
+// Statistics of a single value (for results that are one measurement)
+BenchStats benchSingle(float value);
+
+// ============================================================================
+// RESULTS
+// ============================================================================
+
+struct BenchResult
+{
+    char test[8];
+    char metric[32];
+    const char *unit;
+    BenchStats stats;
+};
+
+void benchSetFormat(BenchFormat format);
+void benchPrintMeta(const char *firmware);
+
+// Stores a result and prints its CSV/JSON line. name is "<test>_<metric>",
+// split at the first underscore (e.g. "C1_FPS_5" -> test C1, metric FPS_5).
+void benchRecord(const char *name, const char *unit, const BenchStats &stats);
+
+size_t benchResultCount();
+const BenchResult &benchResult(size_t i);
+
+#endif // BENCH_H
@@ -0,0 +1,172 @@
+/*
+ * Dirty rectangle tracking and repaint for moving sprites
+ */
+
+#include "DirtyRects.h"
+#include "SpriteTransform.h"
+
+// CASET/RASET/RAMWR sent ahead of every window
+#define WINDOW_SETUP_BYTES 11
+
+// Two rectangles are merged when their bounding box costs no more than
+// sending both, counting a window setup as roughly this many pixels
+#define MERGE_SLACK_PIXELS 64
+
+static inline int32_t rectArea(const DirtyRect &r)
+{
+    return (int32_t)r.w * r.h;
+}
+
+static inline bool rectsIntersect(const DirtyRect &a, const DirtyRect &b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static DirtyRect rectUnion(const DirtyRect &a, const DirtyRect &b)
+{
+    int16_t x0 = min(a.x, b.x);
+    int16_t y0 = min(a.y, b.y);
+    int16_t x1 = max(a.x + a.w, b.x + b.w);
+    int16_t y1 = max(a.y + a.h, b.y + b.h);
+    return {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+static bool rectClip(DirtyRect &r, const DirtyRect &bounds)
+{
+    int16_t x0 = max(r.x, bounds.x);
+    int16_t y0 = max(r.y, bounds.y);
+    int16_t x1 = min(r.x + r.w, bounds.x + bounds.w);
+    int16_t y1 = min(r.y + r.h, bounds.y + bounds.h);
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    r = {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+    return true;
+}
+
+static inline bool worthMerging(const DirtyRect &a, const DirtyRect &b)
+{
+    if (rectsIntersect(a, b))
+        return true;
+    return rectArea(rectUnion(a, b)) <= rectArea(a) + rectArea(b) + MERGE_SLACK_PIXELS;
+}
+
+// ============================================================================
+// TRACKING
+// ============================================================================
+
+void DirtyRectRenderer::begin(int16_t w, int16_t h, uint16_t color)
+{
+    screenW = w;
+    screenH = h;
+    bgColor = color;
+    numRects = 0;
+}
+
+void DirtyRectRenderer::add(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    DirtyRect r = {x, y, w, h};
+    DirtyRect screen = {0, 0, screenW, screenH};
+    if (!rectClip(r, screen))
+        return;
+
+    if (numRects == MAX_RECTS)
+    {
+        merge();
+    }
+    if (numRects == MAX_RECTS)
+    {
+        // Still full: grow whichever rectangle absorbs this one most cheaply
+        int best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (int i = 0; i < numRects; i++)
+        {
+            int32_t growth = rectArea(rectUnion(rects[i], r)) - rectArea(rects[i]);
+            if (growth < bestGrowth)
+            {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        rects[best] = rectUnion(rects[best], r);
+        return;
+    }
+    rects[numRects++] = r;
+}
+
+void DirtyRectRenderer::addMove(int16_t oldX, int16_t oldY, int16_t newX, int16_t newY, int16_t w, int16_t h)
+{
+    DirtyRect before = {oldX, oldY, w, h};
+    DirtyRect after = {newX, newY, w, h};
+    if (worthMerging(before, after))
+    {
+        DirtyRect u = rectUnion(before, after);
+        add(u.x, u.y, u.w, u.h);
+    }
+    else
+    {
+        add(before.x, before.y, w, h);
+        add(after.x, after.y, w, h);
+    }
+}
+
+// Repeats pairwise merging until no pair is worth combining; merged
+// rectangles can newly overlap others, hence the restart
+void DirtyRectRenderer::merge()
+{
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (int i = 0; i < numRects && !merged; i++)
+        {
+            for (int j = i + 1; j < numRects; j++)
+            {
+                if (worthMerging(rects[i], rects[j]))
+                {
+                    rects[i] = rectUnion(rects[i], rects[j]);
+                    rects[j] = rects[--numRects];
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// REPAINT
+// ============================================================================
+
+uint32_t DirtyRectRenderer::flush(TFT_eSPI &tft, const Sprite *sprites, int count,
+                                  const uint16_t *image, int16_t w, int16_t h)
+{
+    uint32_t bytes = 0;
+
+    merge();
+    for (int r = 0; r < numRects; r++)
+    {
+        const DirtyRect &area = rects[r];
+        tft.fillRect(area.x, area.y, area.w, area.h, bgColor);
+        bytes += WINDOW_SETUP_BYTES + rectArea(area) * 2;
+
+        tft.setViewport(area.x, area.y, area.w, area.h, false);
+        for (int i = 0; i < count; i++)
+        {
+            if (!sprites[i].active)
+                continue;
+            DirtyRect bounds = {sprites[i].x, sprites[i].y, w, h};
+            if (!rectClip(bounds, area))
+                continue;
+            // Fish swimming left face left, as in C1 and the compositors
+            if (sprites[i].dx < 0)
+                pushImageFlipped(tft, sprites[i].x, sprites[i].y, w, h, image, area.x, area.y, area.w, area.h);
+            else
+                tft.pushImage(sprites[i].x, sprites[i].y, w, h, image);
+            bytes += WINDOW_SETUP_BYTES + rectArea(bounds) * 2;
+        }
+        tft.resetViewport();
+    }
+
+    numRects = 0;
+    return bytes;
+}
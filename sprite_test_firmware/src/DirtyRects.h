@@ -0,0 +1,51 @@
+/*
+ * Dirty rectangle tracking and repaint for moving sprites
+ *
+ * Each frame the renderer collects the union of every sprite's previous and
+ * current bounds, merges rectangles that overlap (or are cheaper to send as
+ * one window), and repaints only those areas: background fill first, then
+ * every sprite that intersects the area, clipped to it with a viewport so
+ * sprites keep their z-order. Sprites moving left are drawn mirrored.
+ */
+
+#ifndef DIRTY_RECTS_H
+#define DIRTY_RECTS_H
+
+#include <TFT_eSPI.h>
+#include "Sprite.h"
+
+struct DirtyRect
+{
+    int16_t x, y, w, h;
+};
+
+class DirtyRectRenderer
+{
+public:
+    static const int MAX_RECTS = 64;
+
+    void begin(int16_t screenW, int16_t screenH, uint16_t bgColor);
+
+    // Mark an area (clipped to the screen) for repaint this frame
+    void add(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    // Mark the bounding box of a sprite's old and new position
+    void addMove(int16_t oldX, int16_t oldY, int16_t newX, int16_t newY, int16_t w, int16_t h);
+
+    void merge();
+
+    // Repaints the merged areas and clears the list. Returns bytes sent.
+    uint32_t flush(TFT_eSPI &tft, const Sprite *sprites, int count,
+                   const uint16_t *image, int16_t w, int16_t h);
+
+    int rectCount() const { return numRects; }
+    const DirtyRect &rect(int i) const { return rects[i]; }
+
+private:
+    DirtyRect rects[MAX_RECTS];
+    int numRects = 0;
+    int16_t screenW = 0, screenH = 0;
+    uint16_t bgColor = 0;
+};
+
+#endif // DIRTY_RECTS_H
@@ -0,0 +1,126 @@
+/*
+ * Structure-of-arrays store for large numbers of moving entities
+ */
+
+#include "EntityStore.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool EntityStore::begin(uint32_t entities)
+{
+    end();
+
+    // One allocation per field: at 5000 entities, five 10 KB blocks are
+    // easier to find on a fragmented heap than one 50 KB block
+    x = (int16_t *)malloc(entities * sizeof(int16_t));
+    y = (int16_t *)malloc(entities * sizeof(int16_t));
+    vx = (int16_t *)malloc(entities * sizeof(int16_t));
+    vy = (int16_t *)malloc(entities * sizeof(int16_t));
+    life = (uint16_t *)malloc(entities * sizeof(uint16_t));
+    if (!x || !y || !vx || !vy || !life)
+    {
+        end();
+        return false;
+    }
+
+    capacity = entities;
+    count = 0;
+    expired = 0;
+    return true;
+}
+
+void EntityStore::end()
+{
+    free(x);
+    free(y);
+    free(vx);
+    free(vy);
+    free(life);
+    x = y = vx = vy = nullptr;
+    life = nullptr;
+    capacity = 0;
+    count = 0;
+    expired = 0;
+}
+
+int32_t EntityStore::spawn(int16_t px, int16_t py, int16_t pvx, int16_t pvy, uint16_t frames)
+{
+    if (count >= capacity)
+        return -1;
+    x[count] = px;
+    y[count] = py;
+    vx[count] = pvx;
+    vy[count] = pvy;
+    life[count] = frames;
+    return count++;
+}
+
+// The kernel, with the fields as restrict parameters: they never overlap,
+// and saying so lets the compiler keep values in registers instead of
+// reloading them after every store
+static uint32_t stepEntities(int16_t *__restrict x, int16_t *__restrict y,
+                             int16_t *__restrict vx, int16_t *__restrict vy,
+                             uint16_t *__restrict life, uint32_t count,
+                             int32_t limitX, int32_t limitY)
+{
+    uint32_t dead = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int32_t nx = x[i] + vx[i];
+        int32_t ny = y[i] + vy[i];
+
+        // One unsigned compare covers both edges (a negative position wraps
+        // to a huge one), and the branch is only taken on a bounce, where
+        // the position is mirrored back in and the velocity reversed
+        if ((uint32_t)nx > (uint32_t)limitX)
+        {
+            nx = nx < 0 ? -nx : 2 * limitX - nx;
+            vx[i] = -vx[i];
+        }
+        if ((uint32_t)ny > (uint32_t)limitY)
+        {
+            ny = ny < 0 ? -ny : 2 * limitY - ny;
+            vy[i] = -vy[i];
+        }
+        x[i] = nx;
+        y[i] = ny;
+
+        // Lifetimes count down to 0 and stay there
+        uint16_t frames = life[i];
+        frames -= frames != 0;
+        life[i] = frames;
+        dead += frames == 0;
+    }
+    return dead;
+}
+
+uint32_t EntityStore::update(int16_t maxX, int16_t maxY)
+{
+    expired = stepEntities(x, y, vx, vy, life, count,
+                           (int32_t)maxX << ENTITY_FRAC_BITS, (int32_t)maxY << ENTITY_FRAC_BITS);
+    return expired;
+}
+
+uint32_t EntityStore::compact()
+{
+    if (expired == 0)
+        return 0;
+
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (life[i] == 0)
+            continue;
+        x[kept] = x[i];
+        y[kept] = y[i];
+        vx[kept] = vx[i];
+        vy[kept] = vy[i];
+        life[kept] = life[i];
+        kept++;
+    }
+
+    uint32_t removed = count - kept;
+    count = kept;
+    expired = 0;
+    return removed;
+}
@@ -0,0 +1,184 @@
+/*
+ * Generated by tools/png_to_header.py - do not edit
+ *
+ * Sources: test_pattern_32x32.rgb565, test_rgb_30x30.rgb565
+ * RGB565 pixels in panel byte order, for pushFlashImage()
+ */
+
+#ifndef FLASH_ASSETS_H
+#define FLASH_ASSETS_H
+
+#include "FlashImage.h"
+
+// test_pattern_32x32.rgb565: 32x32
+const uint16_t test_pattern_32x32_pixels[32 * 32] PROGMEM = {
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF,
+    0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xE0FF, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07, 0xFF07,
+    0xFF07, 0xFF07, 0xFF07, 0xFF07, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8, 0x1FF8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+};
+constexpr FlashImage test_pattern_32x32 = {32, 32, test_pattern_32x32_pixels};
+
+// test_rgb_30x30.rgb565: 30x30
+const uint16_t test_rgb_30x30_pixels[30 * 30] PROGMEM = {
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007,
+    0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+    0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F8, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007, 0xE007,
+    0xE007, 0xE007, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00, 0x1F00,
+};
+constexpr FlashImage test_rgb_30x30 = {30, 30, test_rgb_30x30_pixels};
+
+#endif // FLASH_ASSETS_H
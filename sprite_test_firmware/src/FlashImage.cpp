@@ -0,0 +1,37 @@
+/*
+ * Zero-copy pushes of images compiled into flash
+ */
+
+#include "FlashImage.h"
+
+void pushFlashImage(TFT_eSPI &tft, int32_t x, int32_t y, const FlashImage &image)
+{
+    int32_t left = x < 0 ? -x : 0;
+    int32_t top = y < 0 ? -y : 0;
+    int32_t right = x + image.width > tft.width() ? tft.width() - x : image.width;
+    int32_t bottom = y + image.height > tft.height() ? tft.height() - y : image.height;
+    if (right <= left || bottom <= top)
+        return;
+
+    bool swap = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+    tft.startWrite();
+    tft.setAddrWindow(x + left, y + top, right - left, bottom - top);
+
+    // Unclipped rows are contiguous in flash: one push for the lot
+    const uint16_t *src = image.pixels + top * image.width + left;
+    if (right - left == image.width)
+    {
+        tft.pushPixels(src, (uint32_t)(bottom - top) * image.width);
+    }
+    else
+    {
+        for (int32_t row = top; row < bottom; row++)
+        {
+            tft.pushPixels(src, right - left);
+            src += image.width;
+        }
+    }
+    tft.endWrite();
+    tft.setSwapBytes(swap);
+}
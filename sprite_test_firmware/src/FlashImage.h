@@ -0,0 +1,27 @@
+/*
+ * Images compiled into flash, drawn without a copy in RAM
+ *
+ * Headers from tools/png_to_header.py hold the pixels in const arrays, which
+ * the ESP32 leaves in flash and maps into the data address space, so they
+ * cost no heap and need no SD card. The pixels are stored in the panel's
+ * byte order, letting pushFlashImage() hand the flash pointer straight to
+ * pushPixels() with byte swapping off: no per-pixel work and no buffer.
+ * (DMA can't read flash, so these pushes are always blocking.)
+ */
+
+#ifndef FLASH_IMAGE_H
+#define FLASH_IMAGE_H
+
+#include <TFT_eSPI.h>
+
+struct FlashImage
+{
+    int16_t width, height;
+    const uint16_t *pixels; // panel byte order
+};
+
+// Pushes the image with its top-left corner at (x, y), clipped to the
+// screen. Leaves setSwapBytes() as it was.
+void pushFlashImage(TFT_eSPI &tft, int32_t x, int32_t y, const FlashImage &image);
+
+#endif // FLASH_IMAGE_H
@@ -0,0 +1,119 @@
+/*
+ * Per-phase frame timing and histogram
+ */
+
+#include "FrameProfiler.h"
+#include <math.h>
+
+static const char *phaseNames[PHASE_COUNT] = {"clear", "update", "addr-window", "push", "idle"};
+
+void FrameProfiler::begin(uint32_t binWidthUs)
+{
+    cyclesPerUs = ESP.getCpuFreqMHz();
+    binWidth = binWidthUs > 0 ? binWidthUs : 1;
+    memset(histogram, 0, sizeof(histogram));
+    memset(phaseCycles, 0, sizeof(phaseCycles));
+    frameCount = 0;
+    minUs = UINT32_MAX;
+    maxUs = 0;
+    sumUs = 0;
+    sumSqUs = 0;
+    frameOpen = false;
+}
+
+void FrameProfiler::endFrame()
+{
+    uint32_t now = ESP.getCycleCount();
+    phaseCycles[PHASE_IDLE] += now - last;
+    last = now;
+    lastEnd = now;
+    frameOpen = true;
+
+    uint32_t us = (now - frameStart) / cyclesPerUs;
+    uint32_t bin = us / binWidth;
+    histogram[bin < HISTOGRAM_BINS ? bin : HISTOGRAM_BINS]++;
+
+    frameCount++;
+    if (us < minUs)
+        minUs = us;
+    if (us > maxUs)
+        maxUs = us;
+    sumUs += us;
+    sumSqUs += (double)us * us;
+}
+
+float FrameProfiler::phaseUs(FramePhase phase) const
+{
+    if (frameCount == 0)
+        return 0;
+    return (float)phaseCycles[phase] / cyclesPerUs / frameCount;
+}
+
+float FrameProfiler::percentileUs(float p) const
+{
+    if (frameCount == 0)
+        return 0;
+
+    // Rank of the sample wanted, then walk the bins to find it
+    float rank = p * (frameCount - 1);
+    uint32_t seen = 0;
+    for (int i = 0; i <= HISTOGRAM_BINS; i++)
+    {
+        if (histogram[i] == 0)
+            continue;
+        if (seen + histogram[i] > rank)
+        {
+            if (i == HISTOGRAM_BINS)
+                return maxUs;
+            // Spread the bin's samples evenly over the part of it that the
+            // observed min and max say was actually used
+            float lo = (float)i * binWidth;
+            float hi = lo + binWidth;
+            if (lo < minUs)
+                lo = minUs;
+            if (hi > maxUs + 1.0f)
+                hi = maxUs + 1.0f;
+            return lo + (hi - lo) * (rank - seen + 0.5f) / histogram[i];
+        }
+        seen += histogram[i];
+    }
+    return maxUs;
+}
+
+BenchStats FrameProfiler::frameStats() const
+{
+    BenchStats s = {0, 0, 0, 0, 0, 0, 0};
+    if (frameCount == 0)
+        return s;
+
+    double mean = sumUs / frameCount;
+    double var = frameCount > 1 ? (sumSqUs - sumUs * mean) / (frameCount - 1) : 0;
+
+    s.n = frameCount;
+    s.min = minUs;
+    s.median = percentileUs(0.50f);
+    s.p95 = percentileUs(0.95f);
+    s.p99 = percentileUs(0.99f);
+    s.mean = mean;
+    s.stddev = var > 0 ? sqrt(var) : 0;
+    return s;
+}
+
+void FrameProfiler::printReport(const char *label) const
+{
+    BenchStats s = frameStats();
+
+    Serial.printf("--- %s: %lu frames ---\n", label, (unsigned long)frameCount);
+    Serial.println("phase          us/frame      %");
+    for (int i = 0; i < PHASE_COUNT; i++)
+    {
+        float us = phaseUs((FramePhase)i);
+        Serial.printf("%-12s %10.1f %6.1f\n", phaseNames[i], us, s.mean > 0 ? us * 100 / s.mean : 0);
+    }
+    Serial.printf("%-12s %10.1f\n", "frame", s.mean);
+    Serial.printf("frame us: min %lu, p50 %.0f, p95 %.0f, p99 %.0f, max %lu\n",
+                  (unsigned long)minUs, s.median, s.p95, s.p99, (unsigned long)maxUs);
+    if (histogram[HISTOGRAM_BINS])
+        Serial.printf("%lu frames above the %lu us histogram range\n",
+                      (unsigned long)histogram[HISTOGRAM_BINS], (unsigned long)(HISTOGRAM_BINS * binWidth));
+}
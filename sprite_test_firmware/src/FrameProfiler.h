@@ -0,0 +1,97 @@
+/*
+ * Per-phase frame timing for the stress tests
+ *
+ * FPS over a wall-clock window says a frame got slower, not why. The
+ * profiler splits every frame into phases (clear, sprite update, address
+ * window setup, pixel push, idle) using the CPU cycle counter, and keeps
+ * frame times in a fixed histogram so nothing is allocated while frames
+ * are being timed.
+ *
+ * Usage per frame:
+ *   profiler.startFrame();
+ *   ... clear ...        profiler.mark(PHASE_CLEAR);
+ *   ... move sprite ...  profiler.mark(PHASE_UPDATE);
+ *   ... setAddrWindow    profiler.mark(PHASE_ADDR_WINDOW);
+ *   ... pushPixels       profiler.mark(PHASE_PUSH);
+ *   profiler.endFrame();
+ *
+ * Time not marked to a phase, including the gap between endFrame() and the
+ * next startFrame(), counts as idle, so frames tile wall time.
+ */
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+#include "Bench.h"
+
+enum FramePhase
+{
+    PHASE_CLEAR,
+    PHASE_UPDATE,
+    PHASE_ADDR_WINDOW,
+    PHASE_PUSH,
+    PHASE_IDLE,
+    PHASE_COUNT
+};
+
+class FrameProfiler
+{
+public:
+    static const int HISTOGRAM_BINS = 128;
+
+    // Clears all counters. Frame times above HISTOGRAM_BINS * binWidthUs
+    // land in an overflow bin (their exact max is still kept).
+    void begin(uint32_t binWidthUs);
+
+    void startFrame()
+    {
+        uint32_t now = ESP.getCycleCount();
+        if (frameOpen)
+        {
+            phaseCycles[PHASE_IDLE] += now - lastEnd;
+            frameStart = lastEnd;
+        }
+        else
+        {
+            frameStart = now;
+        }
+        last = now;
+    }
+
+    void mark(FramePhase phase)
+    {
+        uint32_t now = ESP.getCycleCount();
+        phaseCycles[phase] += now - last;
+        last = now;
+    }
+
+    void endFrame();
+
+    uint32_t frames() const { return frameCount; }
+
+    // Mean time per frame spent in a phase
+    float phaseUs(FramePhase phase) const;
+
+    // Frame time statistics; percentiles are interpolated within a bin
+    BenchStats frameStats() const;
+
+    // Breakdown table and frame-time percentiles on Serial
+    void printReport(const char *label) const;
+
+private:
+    float percentileUs(float p) const;
+
+    uint32_t cyclesPerUs;
+    uint32_t binWidth;
+    uint32_t histogram[HISTOGRAM_BINS + 1];
+    uint64_t phaseCycles[PHASE_COUNT];
+    uint32_t frameCount;
+    uint32_t minUs, maxUs;
+    double sumUs, sumSqUs;
+
+    uint32_t frameStart, last, lastEnd;
+    bool frameOpen;
+};
+
+#endif // FRAME_PROFILER_H
@@ -0,0 +1,126 @@
+/*
+ * Glyph cache: text drawn from pre-rendered glyphs in RAM
+ */
+
+#include "GlyphCache.h"
+
+const GlyphCache::Glyph *GlyphCache::find(char c) const
+{
+    uint8_t code = (uint8_t)c;
+    if (code < GLYPH_FIRST || code >= GLYPH_FIRST + GLYPH_COUNT || !glyphs[code - GLYPH_FIRST].width)
+        return nullptr;
+    return &glyphs[code - GLYPH_FIRST];
+}
+
+// ============================================================================
+// BUILD
+// ============================================================================
+
+bool GlyphCache::build(TFT_eSPI &tft, const char *chars, uint16_t fg, uint16_t bg, int32_t scratchX, int32_t scratchY)
+{
+    end();
+    cellH = tft.fontHeight();
+    int16_t scratchW = 2 * cellH;
+    tft.setTextColor(fg, bg);
+
+    // Advances come from where the cursor ends up: textWidth() of a single
+    // smooth font glyph measures its ink, not its advance
+    for (const char *p = chars; *p; p++)
+    {
+        uint8_t code = (uint8_t)*p;
+        if (code < GLYPH_FIRST || code >= GLYPH_FIRST + GLYPH_COUNT || glyphs[code - GLYPH_FIRST].width)
+            continue;
+        tft.fillRect(scratchX, scratchY, scratchW, cellH, bg);
+        tft.setCursor(scratchX, scratchY);
+        tft.print(*p);
+        int32_t advance = tft.getCursorX() - scratchX;
+        glyphs[code - GLYPH_FIRST].width = (uint8_t)constrain(advance, 1, min((int)scratchW, 255));
+    }
+
+    size_t total = 0;
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        glyphs[i].offset = total;
+        total += (size_t)glyphs[i].width * cellH;
+    }
+    pixels = (uint16_t *)malloc(total * 2);
+    if (!pixels)
+    {
+        Serial.println("Glyph cache allocation failed!");
+        end();
+        return false;
+    }
+    poolBytes = total * 2;
+
+    // Each glyph on a cleared cell, read straight into its slot
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        if (!glyphs[i].width)
+            continue;
+        tft.fillRect(scratchX, scratchY, scratchW, cellH, bg);
+        tft.setCursor(scratchX, scratchY);
+        tft.print((char)(GLYPH_FIRST + i));
+        tft.readRect(scratchX, scratchY, glyphs[i].width, cellH, pixels + glyphs[i].offset);
+    }
+    return true;
+}
+
+void GlyphCache::end()
+{
+    free(pixels);
+    pixels = nullptr;
+    poolBytes = 0;
+    memset(glyphs, 0, sizeof(glyphs));
+}
+
+// ============================================================================
+// DRAW
+// ============================================================================
+
+int16_t GlyphCache::textWidth(const char *text) const
+{
+    int16_t width = 0;
+    for (const char *p = text; *p; p++)
+    {
+        const Glyph *g = find(*p);
+        if (g)
+            width += g->width;
+    }
+    return width;
+}
+
+int16_t GlyphCache::drawString(TFT_eSPI &tft, const char *text, int32_t x, int32_t y)
+{
+    int16_t width = textWidth(text);
+    int32_t c0 = max((int32_t)0, -x), c1 = min((int32_t)width, (int32_t)(tft.width() - x));
+    int32_t r0 = max((int32_t)0, -y), r1 = min((int32_t)cellH, (int32_t)(tft.height() - y));
+    c1 = min(c1, (int32_t)(c0 + GLYPH_LINE_MAX));
+    if (!pixels || c0 >= c1 || r0 >= r1)
+        return width;
+
+    // Glyphs are already in panel byte order
+    uint16_t line[GLYPH_LINE_MAX];
+    bool swap = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+    tft.startWrite();
+    tft.setAddrWindow(x + c0, y + r0, c1 - c0, r1 - r0);
+    for (int32_t row = r0; row < r1; row++)
+    {
+        // Copy the part of each glyph's row that lies in [c0, c1)
+        int32_t col = 0;
+        for (const char *p = text; *p && col < c1; p++)
+        {
+            const Glyph *g = find(*p);
+            if (!g)
+                continue;
+            int32_t from = max(col, c0), to = min(col + g->width, c1);
+            if (from < to)
+                memcpy(line + from - c0, pixels + g->offset + row * g->width + (from - col), (to - from) * 2);
+            col += g->width;
+        }
+        tft.pushPixels(line, c1 - c0);
+    }
+    tft.endWrite();
+    tft.setSwapBytes(swap);
+    return width;
+}
@@ -0,0 +1,67 @@
+/*
+ * Glyph cache: text drawn from pre-rendered glyphs in RAM
+ *
+ * TFT_eSPI rasterises every character on every call. A GLCD glyph at size
+ * 1 is a single 6x8 window, but larger sizes and smooth fonts go out a
+ * pixel or a line at a time, each behind its own address window, so HUD
+ * text redrawn every frame pays for that over and over.
+ *
+ * The cache renders each glyph it is given once, through TFT_eSPI itself so
+ * any font works (GLCD, numbered or smooth), reads it back from the panel
+ * and keeps it in RAM in panel byte order. Drawing a string then assembles
+ * each pixel row from the cached glyphs in a line buffer and pushes the
+ * rows into one address window.
+ *
+ * A cache holds one font, size and colour pair, background filled; build
+ * it again after changing any of them. Ink that reaches past a glyph's
+ * advance (some smooth font italics and kerned pairs) is cut off.
+ */
+
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <TFT_eSPI.h>
+
+// Printable ASCII only
+#define GLYPH_FIRST 0x20
+#define GLYPH_COUNT 95
+
+// Widest string pushed (the line buffer, on the stack)
+#define GLYPH_LINE_MAX 320
+
+class GlyphCache
+{
+public:
+    ~GlyphCache() { end(); }
+
+    // Renders every distinct character of chars with the current font and
+    // text size in fg on bg. The screen at (scratchX, scratchY) is drawn
+    // over while doing so, two character heights wide and one high; the
+    // caller redraws it. Returns false if the glyphs don't fit in memory.
+    bool build(TFT_eSPI &tft, const char *chars, uint16_t fg, uint16_t bg, int32_t scratchX, int32_t scratchY);
+    void end();
+
+    // Draws text with its top-left corner at (x, y), clipped to the screen.
+    // Characters not in the cache are skipped. Returns the width.
+    int16_t drawString(TFT_eSPI &tft, const char *text, int32_t x, int32_t y);
+
+    int16_t textWidth(const char *text) const;
+    int16_t height() const { return cellH; }
+    size_t bytes() const { return poolBytes; }
+
+private:
+    struct Glyph
+    {
+        uint32_t offset; // into pixels, width x cellH
+        uint8_t width;   // advance; 0 if not cached
+    };
+
+    const Glyph *find(char c) const;
+
+    Glyph glyphs[GLYPH_COUNT] = {};
+    uint16_t *pixels = nullptr;
+    size_t poolBytes = 0;
+    int16_t cellH = 0;
+};
+
+#endif // GLYPH_CACHE_H
@@ -0,0 +1,152 @@
+/*
+ * Scrolling backgrounds with the ILI9341 hardware vertical scroll
+ */
+
+#include "HardwareScroll.h"
+
+// ILI9341 vertical scrolling definition and start address
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_VSCRSADR 0x37
+
+// Panel rows along the scroll axis
+#define SCROLL_PANEL_LINES TFT_HEIGHT
+
+// Non-negative remainder, for positions below zero
+static inline int32_t wrap(int32_t v, int32_t n)
+{
+    int32_t r = v % n;
+    return r < 0 ? r + n : r;
+}
+
+void HardwareScroller::sendScrollArea(uint16_t top, uint16_t area, uint16_t bottom)
+{
+    display->writecommand(ILI9341_VSCRDEF);
+    display->writedata(top >> 8);
+    display->writedata(top & 0xFF);
+    display->writedata(area >> 8);
+    display->writedata(area & 0xFF);
+    display->writedata(bottom >> 8);
+    display->writedata(bottom & 0xFF);
+}
+
+bool HardwareScroller::begin(TFT_eSPI &tft, uint16_t head, uint16_t tail)
+{
+    if (head + tail >= SCROLL_PANEL_LINES)
+        return false;
+
+    // Rotations 2 and 3 run the screen axis against the panel rows, so
+    // the head is at the bottom of the panel's scroll definition there
+    display = &tft;
+    uint8_t rotation = tft.getRotation() & 3;
+    portrait = !(rotation & 1);
+    reversed = rotation >= 2;
+    headLines = head;
+    tailLines = tail;
+    length = SCROLL_PANEL_LINES - head - tail;
+
+    if (reversed)
+        sendScrollArea(tail, length, head);
+    else
+        sendScrollArea(head, length, tail);
+    scrollTo(0);
+    return true;
+}
+
+void HardwareScroller::end()
+{
+    if (!display)
+        return;
+    sendScrollArea(0, SCROLL_PANEL_LINES, 0);
+    display->writecommand(ILI9341_VSCRSADR);
+    display->writedata(0);
+    display->writedata(0);
+    display = nullptr;
+}
+
+// World lines live in a ring of GRAM rows after the top fixed area. The
+// panel shows the ring starting at row VSP; in the reversed rotations the
+// ring runs backwards, which puts world line w at screen head + (w - 1)
+// and needs VSP at 1 - position.
+void HardwareScroller::scrollTo(int32_t pos)
+{
+    position = pos;
+    uint16_t top = reversed ? tailLines : headLines;
+    uint16_t vsp = top + wrap(reversed ? 1 - pos : pos, length);
+    display->writecommand(ILI9341_VSCRSADR);
+    display->writedata(vsp >> 8);
+    display->writedata(vsp & 0xFF);
+}
+
+int16_t HardwareScroller::lineToScreen(int32_t line) const
+{
+    return headLines + wrap(reversed ? line - 1 : line, length);
+}
+
+uint32_t HardwareScroller::scroll(int32_t lines, const uint16_t *image, int16_t imageW, int16_t imageH)
+{
+    if (lines == 0)
+        return 0;
+    scrollTo(position + lines);
+
+    // VSCRSADR: command and two parameter bytes
+    uint32_t bytes = 3;
+    uint32_t count = lines > 0 ? lines : -lines;
+    if (count >= length)
+        return bytes + drawLines(position, length, image, imageW, imageH);
+    if (lines > 0)
+        return bytes + drawLines(position + length - lines, lines, image, imageW, imageH);
+    return bytes + drawLines(position, -lines, image, imageW, imageH);
+}
+
+uint32_t HardwareScroller::drawLines(int32_t line, uint16_t count, const uint16_t *image, int16_t imageW, int16_t imageH)
+{
+    // The image has to span the screen across the scroll axis
+    if (!display || (portrait ? imageW != display->width() : imageH != display->height()))
+        return 0;
+
+    // A run that reaches the end of the ring carries on at its start
+    uint32_t bytes = 0;
+    while (count > 0)
+    {
+        int16_t at = lineToScreen(line);
+        uint16_t run = headLines + length - at;
+        if (run > count)
+            run = count;
+        bytes += drawRun(at, line, run, image, imageW, imageH);
+        line += run;
+        count -= run;
+    }
+    return bytes;
+}
+
+// One window for the run; lines are image rows in portrait and image
+// columns in landscape, the image wrapping along the scroll axis
+uint32_t HardwareScroller::drawRun(int16_t at, int32_t line, uint16_t count, const uint16_t *image, int16_t imageW, int16_t imageH)
+{
+    display->startWrite();
+    if (portrait)
+    {
+        display->setAddrWindow(0, at, imageW, count);
+        for (uint16_t i = 0; i < count; i++)
+            display->pushPixels(image + wrap(line + i, imageH) * imageW, imageW);
+    }
+    else
+    {
+        display->setAddrWindow(at, 0, count, imageH);
+        for (int16_t row = 0; row < imageH; row++)
+        {
+            const uint16_t *src = image + row * imageW;
+            for (uint16_t done = 0; done < count;)
+            {
+                int32_t col = wrap(line + done, imageW);
+                uint16_t n = count - done;
+                if (n > imageW - col)
+                    n = imageW - col;
+                display->pushPixels(src + col, n);
+                done += n;
+            }
+        }
+    }
+    display->endWrite();
+    return 11 + (uint32_t)count * (portrait ? imageW : imageH) * 2;
+}
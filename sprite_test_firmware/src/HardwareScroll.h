@@ -0,0 +1,74 @@
+/*
+ * Scrolling backgrounds with the ILI9341 hardware vertical scroll
+ *
+ * The panel can show its GRAM rotated by any number of rows (VSCRSADR)
+ * inside a scroll area with fixed rows above and below it (VSCRDEF). Used
+ * as a ring buffer, scrolling the background by n lines costs one 3-byte
+ * command plus the n newly exposed lines instead of the whole image.
+ *
+ * The scroll always runs along the panel's native 320-pixel axis: up and
+ * down in the portrait rotations, left and right in the landscape ones.
+ * Everything here is in screen terms of the current TFT_eSPI rotation:
+ * the scroll axis is y (portrait) or x (landscape), the head is its low
+ * end (top or left) and the tail its high end. Increasing the position
+ * moves the content toward the head, with new lines entering at the tail.
+ *
+ * Content is addressed by world line: world line w is shown at screen
+ * coordinate head + (w - position) while it is in view. Where it sits in
+ * GRAM, and so where TFT_eSPI has to draw it, is fixed and given by
+ * lineToScreen(). The fixed head and tail areas don't move and can carry
+ * a HUD drawn with the normal TFT_eSPI calls.
+ */
+
+#ifndef HARDWARE_SCROLL_H
+#define HARDWARE_SCROLL_H
+
+#include <TFT_eSPI.h>
+
+class HardwareScroller
+{
+public:
+    // Defines the scroll area between head and tail fixed lines for the
+    // current rotation and scrolls to position 0. Call again after
+    // setRotation(). Returns false if the fixed areas leave no scroll area.
+    bool begin(TFT_eSPI &tft, uint16_t head, uint16_t tail);
+
+    // Back to a full-screen scroll area at offset 0, so GRAM shows as
+    // drawn again
+    void end();
+
+    // Shows world lines [position, position + getLength()) in the scroll
+    // area. Sends VSCRSADR only; the caller draws any lines that came in.
+    void scrollTo(int32_t position);
+
+    // Scrolls by lines (negative toward the tail) and draws the lines that
+    // come into view from image, which is tiled along the scroll axis and
+    // must match the screen across it. Returns bytes sent.
+    uint32_t scroll(int32_t lines, const uint16_t *image, int16_t imageW, int16_t imageH);
+
+    // Draws world lines [line, line + count) from image into GRAM.
+    // Returns bytes sent.
+    uint32_t drawLines(int32_t line, uint16_t count, const uint16_t *image, int16_t imageW, int16_t imageH);
+
+    // Screen coordinate along the scroll axis where TFT_eSPI draws a world
+    // line (in GRAM, not where it is shown)
+    int16_t lineToScreen(int32_t line) const;
+
+    int32_t getPosition() const { return position; }
+    uint16_t getLength() const { return length; }
+    uint16_t getHead() const { return headLines; }
+    uint16_t getTail() const { return tailLines; }
+    bool isPortrait() const { return portrait; }
+
+private:
+    void sendScrollArea(uint16_t top, uint16_t area, uint16_t bottom);
+    uint32_t drawRun(int16_t at, int32_t line, uint16_t count, const uint16_t *image, int16_t imageW, int16_t imageH);
+
+    TFT_eSPI *display = nullptr;
+    int32_t position = 0;
+    uint16_t headLines = 0, tailLines = 0, length = 0;
+    bool portrait = true;
+    bool reversed = false;
+};
+
+#endif // HARDWARE_SCROLL_H
@@ -0,0 +1,122 @@
+/*
+ * 8-bit indexed image loading and expand-on-push
+ */
+
+#include "IndexedImage.h"
+#include <SD.h>
+
+#define IDX8_HEADER_BYTES 10
+
+bool loadIndexedFromSD(const char *filepath, IndexedImage &image)
+{
+    image.width = image.height = 0;
+    image.colors = 0;
+    image.pixels = nullptr;
+
+    File file = SD.open(filepath);
+    if (!file)
+    {
+        Serial.print("Failed to open: ");
+        Serial.println(filepath);
+        return false;
+    }
+
+    uint8_t header[IDX8_HEADER_BYTES];
+    if (file.read(header, IDX8_HEADER_BYTES) != IDX8_HEADER_BYTES || memcmp(header, "IDX8", 4) != 0)
+    {
+        Serial.print("Not an indexed image: ");
+        Serial.println(filepath);
+        file.close();
+        return false;
+    }
+
+    image.width = header[4] | (header[5] << 8);
+    image.height = header[6] | (header[7] << 8);
+    image.colors = header[8] | (header[9] << 8);
+
+    size_t pixelBytes = (size_t)image.width * image.height;
+    size_t expectedSize = IDX8_HEADER_BYTES + image.colors * 2 + pixelBytes;
+    if (image.colors == 0 || image.colors > 256 || file.size() != expectedSize)
+    {
+        Serial.print("Bad indexed image header: ");
+        Serial.println(filepath);
+        file.close();
+        return false;
+    }
+
+    // Unused entries stay black so a corrupt index cannot read past the palette
+    memset(image.palette, 0, sizeof(image.palette));
+    if (file.read((uint8_t *)image.palette, image.colors * 2) != image.colors * 2)
+    {
+        file.close();
+        return false;
+    }
+
+    image.pixels = (uint8_t *)malloc(pixelBytes);
+    if (!image.pixels)
+    {
+        Serial.println("Indexed image allocation failed!");
+        file.close();
+        return false;
+    }
+
+    size_t bytesRead = file.read(image.pixels, pixelBytes);
+    file.close();
+    if (bytesRead != pixelBytes)
+    {
+        freeIndexed(image);
+        return false;
+    }
+
+    Serial.print("Loaded ");
+    Serial.print(image.colors);
+    Serial.print(" colours + ");
+    Serial.print(bytesRead);
+    Serial.print(" indices from ");
+    Serial.println(filepath);
+    return true;
+}
+
+void freeIndexed(IndexedImage &image)
+{
+    free(image.pixels);
+    image.pixels = nullptr;
+}
+
+// ============================================================================
+// EXPAND-ON-PUSH
+// ============================================================================
+
+void pushIndexedImage(TFT_eSPI &tft, int32_t x, int32_t y, const IndexedImage &image,
+                      uint16_t *lineBuffer)
+{
+    uint16_t *line = lineBuffer ? lineBuffer : (uint16_t *)malloc(image.width * 2);
+    if (!line)
+        return;
+
+    // A fully visible image is one window streamed line by line; anything
+    // else goes through pushImage() per line, which clips
+    bool onScreen = x >= 0 && y >= 0 &&
+                    x + image.width <= tft.width() && y + image.height <= tft.height();
+
+    tft.startWrite();
+    if (onScreen)
+        tft.setAddrWindow(x, y, image.width, image.height);
+
+    const uint8_t *src = image.pixels;
+    for (int16_t row = 0; row < image.height; row++)
+    {
+        for (int16_t i = 0; i < image.width; i++)
+            line[i] = image.palette[src[i]];
+        src += image.width;
+
+        if (onScreen)
+            tft.pushPixels(line, image.width);
+        else
+            tft.pushImage(x, y + row, image.width, 1, line);
+    }
+    tft.endWrite();
+
+    if (!lineBuffer)
+        free(line);
+}
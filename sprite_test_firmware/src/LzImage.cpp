@@ -0,0 +1,336 @@
+/*
+ * LZ-compressed image decoding, to a buffer or streamed to the panel
+ */
+
+#include "LzImage.h"
+
+#define LZ_HEADER_BYTES 12
+
+// Window sizes the compressor may choose, in units
+#define LZ_MIN_WINDOW_BITS 8
+#define LZ_MAX_WINDOW_BITS 12
+
+bool LzReader::open(const char *filepath)
+{
+    close();
+    file = SD.open(filepath);
+    if (!file)
+    {
+        Serial.print("Failed to open: ");
+        Serial.println(filepath);
+        return false;
+    }
+
+    input = (uint8_t *)malloc(LZ_INPUT_BYTES);
+    if (!input)
+    {
+        Serial.println("LZ input buffer allocation failed!");
+        close();
+        return false;
+    }
+    fromFile = true;
+    compressedSize = file.size();
+    if (!readHeader())
+    {
+        Serial.print("Bad compressed image: ");
+        Serial.println(filepath);
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool LzReader::open(const uint8_t *data, size_t size)
+{
+    close();
+    inPos = data;
+    inEnd = data + size;
+    compressedSize = size;
+    if (!readHeader())
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void LzReader::close()
+{
+    if (file)
+        file.close();
+    free(input);
+    free(window);
+    input = nullptr;
+    window = nullptr;
+    inPos = inEnd = nullptr;
+    fromFile = false;
+    unitsLeft = 0;
+    workingBytes = 0;
+}
+
+bool LzReader::refill()
+{
+    if (!fromFile)
+        return false;
+    size_t n = file.read(input, LZ_INPUT_BYTES);
+    if (n == 0)
+        return false;
+    inPos = input;
+    inEnd = input + n;
+    return true;
+}
+
+bool LzReader::readHeader()
+{
+    uint8_t header[LZ_HEADER_BYTES];
+    for (int i = 0; i < LZ_HEADER_BYTES; i++)
+    {
+        int c = nextByte();
+        if (c < 0)
+            return false;
+        header[i] = c;
+    }
+    if (memcmp(header, "LZI1", 4) != 0)
+        return false;
+
+    format = header[4];
+    windowBits = header[5];
+    width = header[6] | (header[7] << 8);
+    height = header[8] | (header[9] << 8);
+    colors = header[10] | (header[11] << 8);
+    bool indexed = format == LZ_FORMAT_INDEXED;
+    if ((!indexed && format != LZ_FORMAT_RGB565) || (indexed && (colors == 0 || colors > 256)) ||
+        windowBits < LZ_MIN_WINDOW_BITS || windowBits > LZ_MAX_WINDOW_BITS || width <= 0 || height <= 0)
+        return false;
+
+    // Unused entries stay black so a corrupt index cannot read past the palette
+    memset(palette, 0, sizeof(palette));
+    for (uint16_t i = 0; indexed && i < colors; i++)
+    {
+        int lo = nextByte();
+        int hi = nextByte();
+        if (hi < 0)
+            return false;
+        palette[i] = lo | (hi << 8);
+    }
+
+    // A back reference must save bytes over literals: two units of RGB565,
+    // three of indices, for a two-byte token
+    unitBytes = indexed ? 1 : 2;
+    minMatch = indexed ? 3 : 2;
+    uint32_t windowBytes = (1UL << windowBits) * unitBytes;
+    window = (uint8_t *)calloc(windowBytes, 1);
+    if (!window)
+        return false;
+    windowMask = windowBytes - 1;
+    windowPos = 0;
+    flags = flagBits = 0;
+    matchLeft = matchDistance = 0;
+    unitsLeft = (size_t)width * height;
+    workingBytes = windowBytes + (fromFile ? LZ_INPUT_BYTES : 0);
+    return true;
+}
+
+// Groups of eight items, each a literal unit or a back reference, behind a
+// flag byte (bit set = literal, lowest bit first). A reference is a 16-bit
+// token: distance - 1 in units in the low windowBits, length - minMatch
+// above, with one more byte added to the length when that field is full.
+size_t LzReader::readUnits(uint8_t *dest, size_t count)
+{
+    const uint32_t distanceMask = (1UL << windowBits) - 1;
+    const uint32_t lengthFull = 0xFFFF >> windowBits;
+
+    size_t done = 0;
+    while (done < count && unitsLeft > 0)
+    {
+        if (matchLeft == 0)
+        {
+            if (flagBits == 0)
+            {
+                int f = nextByte();
+                if (f < 0)
+                    break;
+                flags = f;
+                flagBits = 8;
+            }
+            bool literal = flags & 1;
+            flags >>= 1;
+            flagBits--;
+
+            if (literal)
+            {
+                for (uint8_t b = 0; b < unitBytes; b++)
+                {
+                    int c = nextByte();
+                    if (c < 0)
+                    {
+                        unitsLeft = 0;
+                        return done;
+                    }
+                    window[windowPos] = c;
+                    windowPos = (windowPos + 1) & windowMask;
+                    *dest++ = c;
+                }
+                done++;
+                unitsLeft--;
+                continue;
+            }
+
+            int lo = nextByte();
+            int hi = nextByte();
+            if (hi < 0)
+                break;
+            uint32_t token = lo | (hi << 8);
+            matchDistance = ((token & distanceMask) + 1) * unitBytes;
+            matchLeft = (token >> windowBits) + minMatch;
+            if ((token >> windowBits) == lengthFull)
+            {
+                int extra = nextByte();
+                if (extra < 0)
+                    break;
+                matchLeft += extra;
+            }
+        }
+
+        // Copy from the window a byte at a time: a reference may overlap the
+        // bytes it produces (a run is a distance of one unit)
+        size_t n = matchLeft;
+        if (n > count - done)
+            n = count - done;
+        if (n > unitsLeft)
+            n = unitsLeft;
+        uint32_t from = (windowPos - matchDistance) & windowMask;
+        for (uint32_t i = 0; i < n * unitBytes; i++)
+        {
+            uint8_t c = window[from];
+            from = (from + 1) & windowMask;
+            window[windowPos] = c;
+            windowPos = (windowPos + 1) & windowMask;
+            *dest++ = c;
+        }
+        matchLeft -= n;
+        done += n;
+        unitsLeft -= n;
+    }
+
+    // Whatever stopped the loop early was the end of the input
+    if (done < count)
+        unitsLeft = 0;
+    return done;
+}
+
+size_t LzReader::readPixels(uint16_t *dest, size_t count)
+{
+    if (!window)
+        return 0;
+    if (format == LZ_FORMAT_RGB565)
+        return readUnits((uint8_t *)dest, count);
+
+    // Indices are decoded into the back half of dest and expanded forwards:
+    // pixel i overwrites bytes 2i and 2i+1, never an index not yet read
+    uint8_t *indices = (uint8_t *)dest + count;
+    size_t n = readUnits(indices, count);
+    for (size_t i = 0; i < n; i++)
+        dest[i] = palette[indices[i]];
+    return n;
+}
+
+// ============================================================================
+// LOADING AND STREAMING
+// ============================================================================
+
+bool loadLzFromSD(const char *filepath, uint16_t *buffer, int16_t w, int16_t h)
+{
+    LzReader reader;
+    if (!reader.open(filepath))
+        return false;
+    if (reader.width != w || reader.height != h)
+    {
+        Serial.print("Size mismatch: ");
+        Serial.print(reader.width);
+        Serial.print("x");
+        Serial.print(reader.height);
+        Serial.print(" vs ");
+        Serial.print(w);
+        Serial.print("x");
+        Serial.println(h);
+        return false;
+    }
+
+    size_t pixels = (size_t)w * h;
+    size_t decoded = reader.readPixels(buffer, pixels);
+
+    Serial.print("Decoded ");
+    Serial.print(decoded * 2);
+    Serial.print(" bytes from ");
+    Serial.print(reader.getCompressedSize());
+    Serial.print(" in ");
+    Serial.println(filepath);
+    return decoded == pixels;
+}
+
+bool streamLzFromSD(TFT_eSPI &tft, const char *filepath, int32_t x, int32_t y,
+                    int16_t chunkRows, StreamStats *stats)
+{
+    unsigned long start = micros();
+
+    if (chunkRows <= 0)
+    {
+        Serial.println("Stream chunk must be at least one row");
+        return false;
+    }
+
+    LzReader reader;
+    if (!reader.open(filepath))
+        return false;
+    int16_t w = reader.width;
+    int16_t h = reader.height;
+
+    size_t chunkBytes = (size_t)w * chunkRows * 2;
+    uint16_t *buffers[2];
+    buffers[0] = (uint16_t *)malloc(chunkBytes);
+    buffers[1] = (uint16_t *)malloc(chunkBytes);
+    if (!buffers[0] || !buffers[1])
+    {
+        Serial.println("Stream buffer allocation failed!");
+        free(buffers[0]);
+        free(buffers[1]);
+        return false;
+    }
+
+    unsigned long firstPixel = 0;
+    bool ok = true;
+    int next = 0;
+
+    tft.startWrite();
+    for (int16_t row = 0; row < h; row += chunkRows)
+    {
+        int16_t rows = min(chunkRows, (int16_t)(h - row));
+        size_t pixels = (size_t)w * rows;
+
+        // Decoding this chunk overlaps the DMA push of the previous one
+        if (reader.readPixels(buffers[next], pixels) != pixels)
+        {
+            ok = false;
+            break;
+        }
+
+        tft.pushImageDMA(x, y + row, w, rows, buffers[next]);
+        if (row == 0)
+            firstPixel = micros() - start;
+        next ^= 1;
+    }
+    tft.dmaWait();
+    tft.endWrite();
+
+    free(buffers[0]);
+    free(buffers[1]);
+
+    if (stats)
+    {
+        stats->firstPixelUs = firstPixel;
+        stats->totalUs = micros() - start;
+        stats->peakBytes = chunkBytes * 2 + reader.getWorkingBytes();
+    }
+    return ok;
+}
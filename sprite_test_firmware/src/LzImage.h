@@ -0,0 +1,101 @@
+/*
+ * LZ-compressed images: RGB565 or 8-bit indexed pixels behind an LZSS stream
+ *
+ * SD reads dominate asset load times (B1), so reading fewer bytes and
+ * expanding them on the CPU wins when the image compresses. Pixels are
+ * coded in whole units (two bytes for RGB565, one index byte) as literals
+ * or back references into a small sliding window, 2^windowBits units, so
+ * the decoder needs a few KB of history however large the image is, and
+ * can hand out pixels in any chunk size as it goes.
+ * Files are produced by tools/lz_compress.py.
+ */
+
+#ifndef LZ_IMAGE_H
+#define LZ_IMAGE_H
+
+#include <TFT_eSPI.h>
+#include <SD.h>
+#include "StreamLoader.h"
+
+#define LZ_FORMAT_RGB565 0
+#define LZ_FORMAT_INDEXED 1
+
+// Bytes read from the file at a time
+#define LZ_INPUT_BYTES 512
+
+class LzReader
+{
+public:
+    LzReader() = default;
+    ~LzReader() { close(); }
+
+    // Opens a compressed image on SD, or one already in memory (kept by the
+    // caller until close()). Allocates the window. Returns false if the
+    // file is missing or not a valid image, or out of memory.
+    bool open(const char *filepath);
+    bool open(const uint8_t *data, size_t size);
+    void close();
+
+    // Decodes the next count pixels as RGB565, expanding indexed images
+    // through the palette. Returns the pixels written, fewer than count at
+    // the end of the image or on corrupt data.
+    size_t readPixels(uint16_t *dest, size_t count);
+
+    int16_t width = 0, height = 0;
+    uint8_t format = LZ_FORMAT_RGB565;
+    uint16_t colors = 0;
+    uint16_t palette[256];
+
+    // Compressed size, and heap held while open (window and input buffer)
+    size_t getCompressedSize() const { return compressedSize; }
+    size_t getWorkingBytes() const { return workingBytes; }
+
+private:
+    LzReader(const LzReader &) = delete;
+    LzReader &operator=(const LzReader &) = delete;
+
+    bool readHeader();
+    bool refill();
+    size_t readUnits(uint8_t *dest, size_t count);
+
+    // Next input byte, or -1 at the end of the stream
+    inline int nextByte()
+    {
+        if (inPos == inEnd && !refill())
+            return -1;
+        return *inPos++;
+    }
+
+    File file;
+    bool fromFile = false;
+    const uint8_t *inPos = nullptr, *inEnd = nullptr;
+    uint8_t *input = nullptr;
+    size_t compressedSize = 0;
+    size_t workingBytes = 0;
+
+    uint8_t *window = nullptr;
+    uint32_t windowMask = 0;
+    uint32_t windowPos = 0;
+    uint8_t unitBytes = 2;
+    uint8_t windowBits = 0;
+    uint8_t minMatch = 2;
+
+    // Decoder state carried between reads: flag bits left in the current
+    // group, and the rest of a back reference cut short by a full chunk
+    uint8_t flags = 0, flagBits = 0;
+    uint32_t matchLeft = 0, matchDistance = 0;
+    size_t unitsLeft = 0;
+};
+
+// Loads a compressed image into a w x h RGB565 buffer, like
+// loadRGB565FromSD(). Returns false on any error or a size mismatch.
+bool loadLzFromSD(const char *filepath, uint16_t *buffer, int16_t w, int16_t h);
+
+// Decodes a compressed image chunkRows rows at a time into ping-pong buffers
+// and pushes each with DMA while the next is decoded, like
+// streamRGB565FromSD(), and fails like it on a chunkRows that is not
+// positive. peakBytes counts the window too.
+bool streamLzFromSD(TFT_eSPI &tft, const char *filepath, int32_t x, int32_t y,
+                    int16_t chunkRows, StreamStats *stats = nullptr);
+
+#endif // LZ_IMAGE_H
@@ -0,0 +1,119 @@
+/*
+ * Specialized PNG row converters
+ */
+
+#include "PngRows.h"
+
+// PNGdec pixel types (PNG colour types)
+#define PNG_TYPE_GRAYSCALE 0
+#define PNG_TYPE_TRUECOLOR 2
+#define PNG_TYPE_INDEXED 3
+#define PNG_TYPE_GRAY_ALPHA 4
+#define PNG_TYPE_TRUECOLOR_ALPHA 6
+
+// ============================================================================
+// CONVERTERS
+// ============================================================================
+
+static void convertRGBA8888(const uint8_t *src, uint16_t *dst, int width, const uint16_t *table)
+{
+    (void)table;
+    for (int x = 0; x < width; x++, src += 4)
+    {
+        uint8_t a = src[3];
+        if (a == 255)
+            dst[x] = pngPackBGR565(src[0], src[1], src[2]);
+        else if (a == 0)
+            dst[x] = 0;
+        else
+            dst[x] = pngPackBGR565(pngMulDiv255(src[0], a), pngMulDiv255(src[1], a), pngMulDiv255(src[2], a));
+    }
+}
+
+static void convertRGB888(const uint8_t *src, uint16_t *dst, int width, const uint16_t *table)
+{
+    (void)table;
+    for (int x = 0; x < width; x++, src += 3)
+        dst[x] = pngPackBGR565(src[0], src[1], src[2]);
+}
+
+static void convertGrayAlpha88(const uint8_t *src, uint16_t *dst, int width, const uint16_t *table)
+{
+    for (int x = 0; x < width; x++, src += 2)
+        dst[x] = table[pngMulDiv255(src[0], src[1])];
+}
+
+// Indexed and grayscale: BITS-per-pixel indices into the table, packed
+// most significant first
+template <int BITS>
+static void convertTable(const uint8_t *src, uint16_t *dst, int width, const uint16_t *table)
+{
+    const int perByte = 8 / BITS;
+    const uint8_t mask = (1 << BITS) - 1;
+    int x = 0;
+    for (; x + perByte <= width; src++)
+    {
+        uint8_t byte = *src;
+        for (int i = perByte - 1; i >= 0; i--)
+            dst[x++] = table[(byte >> (i * BITS)) & mask];
+    }
+    for (int shift = 8 - BITS; x < width; x++, shift -= BITS)
+        dst[x] = table[(*src >> shift) & mask];
+}
+
+template <>
+void convertTable<8>(const uint8_t *src, uint16_t *dst, int width, const uint16_t *table)
+{
+    for (int x = 0; x < width; x++)
+        dst[x] = table[src[x]];
+}
+
+PngRowConverter pngRowConverter(int pixelType, int bitDepth)
+{
+    switch (pixelType)
+    {
+    case PNG_TYPE_TRUECOLOR_ALPHA:
+        return bitDepth == 8 ? convertRGBA8888 : nullptr;
+    case PNG_TYPE_TRUECOLOR:
+        return bitDepth == 8 ? convertRGB888 : nullptr;
+    case PNG_TYPE_GRAY_ALPHA:
+        return bitDepth == 8 ? convertGrayAlpha88 : nullptr;
+    case PNG_TYPE_INDEXED:
+    case PNG_TYPE_GRAYSCALE:
+        switch (bitDepth)
+        {
+        case 1: return convertTable<1>;
+        case 2: return convertTable<2>;
+        case 4: return convertTable<4>;
+        case 8: return convertTable<8>;
+        }
+        return nullptr;
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// TABLES
+// ============================================================================
+
+void pngBuildRowTable(int pixelType, int bitDepth, const uint8_t *palette, bool hasAlpha, uint16_t *table)
+{
+    if (pixelType == PNG_TYPE_INDEXED)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            const uint8_t *rgb = palette + i * 3;
+            uint8_t a = hasAlpha ? palette[768 + i] : 255;
+            table[i] = pngPackBGR565(pngMulDiv255(rgb[0], a), pngMulDiv255(rgb[1], a), pngMulDiv255(rgb[2], a));
+        }
+        return;
+    }
+
+    // Grey ramp; packed depths scale their top value to 255
+    int maxValue = (1 << bitDepth) - 1;
+    for (int i = 0; i < 256; i++)
+    {
+        uint8_t v = i <= maxValue ? (uint8_t)(i * 255 / maxValue) : 0;
+        table[i] = pngPackBGR565(v, v, v);
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * PNG row converters: one decoded PNG row to BGR565, composited onto black
+ *
+ * pngDraw used to branch on the pixel format for every pixel and divide by
+ * 255 three times per translucent pixel. Here the format is resolved once
+ * per image into a converter specialized at compile time, alpha uses an
+ * exact multiply-shift, and indexed/grayscale images go through a 256-entry
+ * table built once per image (palette and tRNS alpha already applied).
+ *
+ * Output matches the reference per-pixel conversion bit for bit; the
+ * bench-png-rows environment checks every path and times it.
+ */
+
+#ifndef PNG_ROWS_H
+#define PNG_ROWS_H
+
+#include <stdint.h>
+
+typedef void (*PngRowConverter)(const uint8_t *src, uint16_t *dst, int width, const uint16_t *table);
+
+// Converter for a PNGdec pixel type and bit depth (PNGDRAW iPixelType/iBpp),
+// or nullptr when unsupported (16-bit channels)
+PngRowConverter pngRowConverter(int pixelType, int bitDepth);
+
+// Fills the 256-entry table a converter reads: the palette (with tRNS alpha
+// when hasAlpha) for indexed images, the grey ramp for grayscale ones.
+// palette is PNGdec's layout: 256 RGB triplets, then 256 alpha bytes.
+// Grayscale tRNS (a single transparent grey) is not applied.
+void pngBuildRowTable(int pixelType, int bitDepth, const uint8_t *palette, bool hasAlpha, uint16_t *table);
+
+// x * a / 255, exact for 8-bit x and a
+static inline uint8_t pngMulDiv255(uint8_t x, uint8_t a)
+{
+    return (uint8_t)(((uint32_t)x * a * 0x8081u) >> 23);
+}
+
+static inline uint16_t pngPackBGR565(uint8_t r, uint8_t g, uint8_t b)
+{
+    return ((b >> 3) << 11) | ((g >> 2) << 5) | (r >> 3);
+}
+
+#endif // PNG_ROWS_H
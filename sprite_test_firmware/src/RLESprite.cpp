@@ -0,0 +1,170 @@
+/*
+ * Transparent RLE sprite loading and blitting
+ */
+
+#include "RLESprite.h"
+#include <SD.h>
+
+#define RLE_HEADER_BYTES 12
+
+// Walks every run, checking it stays inside the data and the row
+static bool validate(RLESprite &sprite)
+{
+    const uint16_t *p = sprite.data;
+    const uint16_t *end = sprite.data + sprite.words;
+    sprite.runs = 0;
+    sprite.opaquePixels = 0;
+
+    for (int16_t row = 0; row < sprite.height; row++)
+    {
+        if (p >= end)
+            return false;
+        uint16_t runs = *p++;
+        int32_t x = 0;
+        for (uint16_t r = 0; r < runs; r++)
+        {
+            if (end - p < 2)
+                return false;
+            x += p[0];
+            uint16_t len = p[1];
+            p += 2;
+            if (x + len > sprite.width || end - p < len)
+                return false;
+            x += len;
+            p += len;
+            sprite.opaquePixels += len;
+        }
+        sprite.runs += runs;
+    }
+    return p == end;
+}
+
+bool loadRLESpriteFromSD(const char *filepath, RLESprite &sprite)
+{
+    sprite = {0, 0, nullptr, 0, 0, 0};
+
+    File file = SD.open(filepath);
+    if (!file)
+    {
+        Serial.print("Failed to open: ");
+        Serial.println(filepath);
+        return false;
+    }
+
+    uint8_t header[RLE_HEADER_BYTES];
+    if (file.read(header, RLE_HEADER_BYTES) != RLE_HEADER_BYTES || memcmp(header, "RLE1", 4) != 0)
+    {
+        Serial.print("Not an RLE sprite: ");
+        Serial.println(filepath);
+        file.close();
+        return false;
+    }
+
+    sprite.width = header[4] | (header[5] << 8);
+    sprite.height = header[6] | (header[7] << 8);
+    sprite.words = header[8] | (header[9] << 8) | ((uint32_t)header[10] << 16) | ((uint32_t)header[11] << 24);
+
+    if (file.size() != RLE_HEADER_BYTES + sprite.words * 2)
+    {
+        Serial.print("Size mismatch: ");
+        Serial.print(file.size());
+        Serial.print(" vs ");
+        Serial.println(RLE_HEADER_BYTES + sprite.words * 2);
+        file.close();
+        return false;
+    }
+
+    sprite.data = (uint16_t *)malloc(sprite.words * 2);
+    if (!sprite.data)
+    {
+        Serial.println("RLE sprite allocation failed!");
+        file.close();
+        return false;
+    }
+
+    size_t bytesRead = file.read((uint8_t *)sprite.data, sprite.words * 2);
+    file.close();
+
+    if (bytesRead != sprite.words * 2 || !validate(sprite))
+    {
+        Serial.print("Corrupt RLE sprite: ");
+        Serial.println(filepath);
+        freeRLESprite(sprite);
+        return false;
+    }
+
+    Serial.print("Loaded ");
+    Serial.print(sprite.opaquePixels);
+    Serial.print(" opaque pixels in ");
+    Serial.print(sprite.runs);
+    Serial.print(" runs from ");
+    Serial.println(filepath);
+    return true;
+}
+
+void freeRLESprite(RLESprite &sprite)
+{
+    free(sprite.data);
+    sprite.data = nullptr;
+    sprite.words = 0;
+}
+
+// ============================================================================
+// DRAWING
+// ============================================================================
+
+void drawRLESprite(TFT_eSPI &tft, int32_t x, int32_t y, const RLESprite &sprite)
+{
+    const uint16_t *p = sprite.data;
+    bool onScreen = x >= 0 && y >= 0 &&
+                    x + sprite.width <= tft.width() && y + sprite.height <= tft.height();
+
+    tft.startWrite();
+    for (int16_t row = 0; row < sprite.height; row++)
+    {
+        uint16_t runs = *p++;
+        int32_t cx = x;
+        for (uint16_t r = 0; r < runs; r++)
+        {
+            cx += p[0];
+            uint16_t len = p[1];
+            p += 2;
+
+            // Fully visible sprites skip the per-run clipping in pushImage()
+            if (onScreen)
+            {
+                tft.setAddrWindow(cx, y + row, len, 1);
+                tft.pushPixels(p, len);
+            }
+            else
+            {
+                tft.pushImage(cx, y + row, len, 1, p);
+            }
+            cx += len;
+            p += len;
+        }
+    }
+    tft.endWrite();
+}
+
+void expandRLESprite(const RLESprite &sprite, uint16_t *dest, uint16_t background)
+{
+    const uint16_t *p = sprite.data;
+    for (int32_t i = 0; i < (int32_t)sprite.width * sprite.height; i++)
+        dest[i] = background;
+
+    for (int16_t row = 0; row < sprite.height; row++)
+    {
+        uint16_t runs = *p++;
+        uint16_t *out = dest + (int32_t)row * sprite.width;
+        for (uint16_t r = 0; r < runs; r++)
+        {
+            out += p[0];
+            uint16_t len = p[1];
+            p += 2;
+            memcpy(out, p, len * 2);
+            out += len;
+            p += len;
+        }
+    }
+}
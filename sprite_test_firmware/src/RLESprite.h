@@ -0,0 +1,35 @@
+/*
+ * Transparent sprites stored as run-length opaque spans
+ *
+ * Each row is a list of (skip, length, pixels) runs produced from the PNG
+ * alpha channel by tools/png_to_rle565.py. Drawing sends only the opaque
+ * runs, so the pixels around a sprite are left untouched without scanning
+ * for a key colour, and black pixels inside the sprite stay black.
+ */
+
+#ifndef RLE_SPRITE_H
+#define RLE_SPRITE_H
+
+#include <TFT_eSPI.h>
+
+struct RLESprite
+{
+    int16_t width, height;
+    uint16_t *data;    // per row: runs, then {skip, length, pixels...} per run
+    uint32_t words;
+    uint32_t runs;
+    uint32_t opaquePixels;
+};
+
+// Loads a .rle565 file into a malloc'd buffer. Returns false on any error.
+bool loadRLESpriteFromSD(const char *filepath, RLESprite &sprite);
+void freeRLESprite(RLESprite &sprite);
+
+// Draws the opaque runs with their top-left corner at (x, y), honouring
+// setSwapBytes() like pushImage()
+void drawRLESprite(TFT_eSPI &tft, int32_t x, int32_t y, const RLESprite &sprite);
+
+// Writes the sprite over a w x h block filled with background
+void expandRLESprite(const RLESprite &sprite, uint16_t *dest, uint16_t background);
+
+#endif // RLE_SPRITE_H
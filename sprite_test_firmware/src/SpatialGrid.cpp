@@ -0,0 +1,272 @@
+/*
+ * Uniform-grid broadphase for sprite overlap and collision queries
+ */
+
+#include "SpatialGrid.h"
+#include <stdlib.h>
+#include <string.h>
+
+// End of a node list
+#define GRID_NONE 0xFFFF
+
+static inline bool boxesOverlap(int16_t ax, int16_t ay, int16_t aw, int16_t ah,
+                                int16_t bx, int16_t by, int16_t bw, int16_t bh)
+{
+    return ax < bx + bw && bx < ax + aw && ay < by + bh && by < ay + ah;
+}
+
+static inline int16_t clampTo(int16_t v, int16_t lo, int16_t hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+bool SpatialGrid::begin(int16_t width, int16_t height, uint8_t cellShift, uint16_t maxObjects, uint8_t maxSpan)
+{
+    end();
+    uint32_t cellSize = 1UL << cellShift;
+    uint32_t c = (width + cellSize - 1) >> cellShift;
+    uint32_t r = (height + cellSize - 1) >> cellShift;
+    uint32_t poolSize = (uint32_t)maxObjects * maxSpan;
+    if (width <= 0 || height <= 0 || c > 255 || r > 255 || poolSize == 0 || poolSize >= GRID_NONE)
+        return false;
+
+    objects = (Bounds *)malloc(maxObjects * sizeof(Bounds));
+    nodes = (Node *)malloc(poolSize * sizeof(Node));
+    cells = (uint16_t *)malloc(c * r * sizeof(uint16_t));
+    stamps = (uint16_t *)malloc(maxObjects * sizeof(uint16_t));
+    if (!objects || !nodes || !cells || !stamps)
+    {
+        end();
+        return false;
+    }
+
+    fieldW = width;
+    fieldH = height;
+    shift = cellShift;
+    cols = c;
+    rows = r;
+    objectCount = maxObjects;
+    nodeCount = poolSize;
+    clear();
+    return true;
+}
+
+void SpatialGrid::end()
+{
+    free(objects);
+    free(nodes);
+    free(cells);
+    free(stamps);
+    objects = nullptr;
+    nodes = nullptr;
+    cells = nullptr;
+    stamps = nullptr;
+    objectCount = 0;
+    nodeCount = 0;
+}
+
+void SpatialGrid::clear()
+{
+    if (!objects)
+        return;
+    for (uint32_t i = 0; i < (uint32_t)cols * rows; i++)
+        cells[i] = GRID_NONE;
+    for (uint16_t i = 0; i < objectCount; i++)
+        objects[i] = {0, 0, 0, 0, 0, 0, 0, 0, GRID_NONE};
+
+    // Free nodes are chained through nextOfObject
+    for (uint16_t i = 0; i < nodeCount; i++)
+        nodes[i].nextOfObject = i + 1 < nodeCount ? i + 1 : GRID_NONE;
+    freeNodes = 0;
+
+    memset(stamps, 0, objectCount * sizeof(uint16_t));
+    stamp = 0;
+    refiles = 0;
+    updates = 0;
+}
+
+// Cells touched by a box, clipped to the playfield. False if it touches none.
+bool SpatialGrid::cellRange(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint8_t &cx0, uint8_t &cy0, uint8_t &cx1, uint8_t &cy1) const
+{
+    if (w <= 0 || h <= 0)
+        return false;
+    int32_t x0 = x < 0 ? 0 : x;
+    int32_t y0 = y < 0 ? 0 : y;
+    int32_t x1 = (int32_t)x + w - 1 < fieldW - 1 ? (int32_t)x + w - 1 : fieldW - 1;
+    int32_t y1 = (int32_t)y + h - 1 < fieldH - 1 ? (int32_t)y + h - 1 : fieldH - 1;
+    if (x0 > x1 || y0 > y1)
+        return false;
+    cx0 = x0 >> shift;
+    cy0 = y0 >> shift;
+    cx1 = x1 >> shift;
+    cy1 = y1 >> shift;
+    return true;
+}
+
+bool SpatialGrid::update(uint16_t id, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (id >= objectCount)
+        return false;
+    updates++;
+
+    Bounds &o = objects[id];
+    uint8_t cx0, cy0, cx1, cy1;
+    bool inside = cellRange(x, y, w, h, cx0, cy0, cx1, cy1);
+    bool sameCells = inside && o.nodes != GRID_NONE &&
+                     cx0 == o.cx0 && cy0 == o.cy0 && cx1 == o.cx1 && cy1 == o.cy1;
+    o.x = x;
+    o.y = y;
+    o.w = w;
+    o.h = h;
+    if (sameCells)
+        return true;
+
+    unfile(id);
+    if (!inside)
+        return true;
+    o.cx0 = cx0;
+    o.cy0 = cy0;
+    o.cx1 = cx1;
+    o.cy1 = cy1;
+    refiles++;
+    return file(id);
+}
+
+void SpatialGrid::unfile(uint16_t id)
+{
+    Bounds &o = objects[id];
+    uint16_t n = o.nodes;
+    while (n != GRID_NONE)
+    {
+        Node &node = nodes[n];
+        if (node.prevInCell != GRID_NONE)
+            nodes[node.prevInCell].nextInCell = node.nextInCell;
+        else
+            cells[node.cell] = node.nextInCell;
+        if (node.nextInCell != GRID_NONE)
+            nodes[node.nextInCell].prevInCell = node.prevInCell;
+
+        uint16_t next = node.nextOfObject;
+        node.nextOfObject = freeNodes;
+        freeNodes = n;
+        n = next;
+    }
+    o.nodes = GRID_NONE;
+}
+
+bool SpatialGrid::file(uint16_t id)
+{
+    Bounds &o = objects[id];
+    for (uint8_t cy = o.cy0; cy <= o.cy1; cy++)
+    {
+        for (uint8_t cx = o.cx0; cx <= o.cx1; cx++)
+        {
+            if (freeNodes == GRID_NONE)
+            {
+                unfile(id);
+                return false;
+            }
+            uint16_t n = freeNodes;
+            Node &node = nodes[n];
+            freeNodes = node.nextOfObject;
+
+            uint16_t cell = cy * cols + cx;
+            node.object = id;
+            node.cell = cell;
+            node.prevInCell = GRID_NONE;
+            node.nextInCell = cells[cell];
+            if (cells[cell] != GRID_NONE)
+                nodes[cells[cell]].prevInCell = n;
+            cells[cell] = n;
+            node.nextOfObject = o.nodes;
+            o.nodes = n;
+        }
+    }
+    return true;
+}
+
+// A pair sharing several cells is reported only from the cell holding the
+// top-left corner of its overlap (clamped to the playfield), so each pair
+// comes out once without a visited set
+uint32_t SpatialGrid::findPairs(GridPair *pairs, uint32_t maxPairs)
+{
+    uint32_t found = 0;
+    for (uint8_t cy = 0; cy < rows; cy++)
+    {
+        for (uint8_t cx = 0; cx < cols; cx++)
+        {
+            for (uint16_t i = cells[cy * cols + cx]; i != GRID_NONE; i = nodes[i].nextInCell)
+            {
+                const Bounds &a = objects[nodes[i].object];
+                for (uint16_t j = nodes[i].nextInCell; j != GRID_NONE; j = nodes[j].nextInCell)
+                {
+                    const Bounds &b = objects[nodes[j].object];
+                    if (!boxesOverlap(a.x, a.y, a.w, a.h, b.x, b.y, b.w, b.h))
+                        continue;
+
+                    int16_t ox = clampTo(a.x > b.x ? a.x : b.x, 0, fieldW - 1);
+                    int16_t oy = clampTo(a.y > b.y ? a.y : b.y, 0, fieldH - 1);
+                    if ((ox >> shift) != cx || (oy >> shift) != cy)
+                        continue;
+
+                    if (found < maxPairs)
+                    {
+                        uint16_t ida = nodes[i].object, idb = nodes[j].object;
+                        pairs[found].a = ida < idb ? ida : idb;
+                        pairs[found].b = ida < idb ? idb : ida;
+                    }
+                    found++;
+                }
+            }
+        }
+    }
+    return found;
+}
+
+uint16_t SpatialGrid::nextStamp()
+{
+    if (++stamp == 0)
+    {
+        memset(stamps, 0, objectCount * sizeof(uint16_t));
+        stamp = 1;
+    }
+    return stamp;
+}
+
+uint16_t SpatialGrid::queryRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *ids, uint16_t maxIds)
+{
+    uint8_t cx0, cy0, cx1, cy1;
+    if (!cellRange(x, y, w, h, cx0, cy0, cx1, cy1))
+        return 0;
+
+    // Objects spanning several cells are met more than once
+    uint16_t visit = nextStamp();
+    uint16_t found = 0;
+    for (uint8_t cy = cy0; cy <= cy1; cy++)
+    {
+        for (uint8_t cx = cx0; cx <= cx1; cx++)
+        {
+            for (uint16_t i = cells[cy * cols + cx]; i != GRID_NONE; i = nodes[i].nextInCell)
+            {
+                uint16_t id = nodes[i].object;
+                if (stamps[id] == visit)
+                    continue;
+                stamps[id] = visit;
+
+                const Bounds &o = objects[id];
+                if (!boxesOverlap(o.x, o.y, o.w, o.h, x, y, w, h))
+                    continue;
+                if (found < maxIds)
+                    ids[found] = id;
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+uint16_t SpatialGrid::queryPoint(int16_t x, int16_t y, uint16_t *ids, uint16_t maxIds)
+{
+    return queryRect(x, y, 1, 1, ids, maxIds);
+}
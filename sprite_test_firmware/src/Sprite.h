@@ -0,0 +1,33 @@
+/*
+ * Moving sprite state shared by the stress tests and renderers
+ */
+
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+
+struct Sprite
+{
+    int16_t x, y;
+    int16_t dx, dy;
+    bool active;
+};
+
+// Advance one frame, bouncing off the [0, maxX] x [0, maxY] box
+inline void moveSprite(Sprite &s, int16_t maxX, int16_t maxY)
+{
+    s.x += s.dx;
+    s.y += s.dy;
+
+    if (s.x <= 0 || s.x >= maxX)
+    {
+        s.dx = -s.dx;
+    }
+    if (s.y <= 0 || s.y >= maxY)
+    {
+        s.dy = -s.dy;
+    }
+}
+
+#endif // SPRITE_H
@@ -0,0 +1,141 @@
+/*
+ * Sprite atlas loading
+ */
+
+#include "SpriteAtlas.h"
+
+#define ATLAS_HEADER_BYTES 8
+#define ATLAS_ENTRY_BYTES 20
+
+static uint32_t readLE32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t readLE16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+// FNV-1a, matching fnv1a() in tools/pack_atlas.py
+uint32_t SpriteAtlas::hashName(const char *name)
+{
+    uint32_t h = 0x811C9DC5;
+    while (*name)
+    {
+        h ^= (uint8_t)*name++;
+        h *= 0x01000193;
+    }
+    return h;
+}
+
+bool SpriteAtlas::open(const char *filepath)
+{
+    close();
+
+    file = SD.open(filepath);
+    if (!file)
+    {
+        Serial.print("Failed to open: ");
+        Serial.println(filepath);
+        return false;
+    }
+
+    uint8_t header[ATLAS_HEADER_BYTES];
+    if (file.read(header, ATLAS_HEADER_BYTES) != ATLAS_HEADER_BYTES || memcmp(header, "ATL1", 4) != 0)
+    {
+        Serial.print("Not a sprite atlas: ");
+        Serial.println(filepath);
+        file.close();
+        return false;
+    }
+
+    uint16_t n = readLE16(header + 4);
+    uint8_t *table = (uint8_t *)malloc((size_t)n * ATLAS_ENTRY_BYTES);
+    entries = (AtlasEntry *)malloc((size_t)n * sizeof(AtlasEntry));
+    if (!table || !entries || file.read(table, (size_t)n * ATLAS_ENTRY_BYTES) != (size_t)n * ATLAS_ENTRY_BYTES)
+    {
+        Serial.print("Bad atlas table: ");
+        Serial.println(filepath);
+        free(table);
+        close();
+        return false;
+    }
+
+    // Unpack from the packed on-disk layout and reject entries past the end
+    size_t fileSize = file.size();
+    for (uint16_t i = 0; i < n; i++)
+    {
+        const uint8_t *e = table + i * ATLAS_ENTRY_BYTES;
+        entries[i].hash = readLE32(e);
+        entries[i].offset = readLE32(e + 4);
+        entries[i].size = readLE32(e + 8);
+        entries[i].width = readLE16(e + 12);
+        entries[i].height = readLE16(e + 14);
+        entries[i].format = e[16];
+        if (entries[i].offset + (size_t)entries[i].size > fileSize)
+        {
+            Serial.print("Atlas entry out of range: ");
+            Serial.println(i);
+            free(table);
+            close();
+            return false;
+        }
+    }
+    free(table);
+    count = n;
+
+    Serial.print("Atlas ");
+    Serial.print(filepath);
+    Serial.print(": ");
+    Serial.print(count);
+    Serial.println(" sprites");
+    return true;
+}
+
+void SpriteAtlas::close()
+{
+    if (file)
+        file.close();
+    free(entries);
+    entries = nullptr;
+    count = 0;
+}
+
+const AtlasEntry *SpriteAtlas::find(const char *name, uint8_t format) const
+{
+    uint32_t h = hashName(name);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (entries[i].hash == h && entries[i].format == format)
+            return &entries[i];
+    }
+    return nullptr;
+}
+
+bool SpriteAtlas::read(const AtlasEntry &entry, void *dest, size_t size)
+{
+    if (!entries || size != entry.size || !file.seek(entry.offset))
+        return false;
+    return file.read((uint8_t *)dest, size) == size;
+}
+
+bool SpriteAtlas::loadRGB565(const char *name, uint16_t *buffer, size_t expectedSize)
+{
+    const AtlasEntry *entry = find(name, ATLAS_RGB565);
+    if (!entry)
+    {
+        Serial.print("Not in atlas: ");
+        Serial.println(name);
+        return false;
+    }
+    if (entry->size != expectedSize)
+    {
+        Serial.print("Size mismatch: ");
+        Serial.print(entry->size);
+        Serial.print(" vs ");
+        Serial.println(expectedSize);
+        return false;
+    }
+    return read(*entry, buffer, expectedSize);
+}
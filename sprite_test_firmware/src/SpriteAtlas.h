@@ -0,0 +1,61 @@
+/*
+ * Sprite atlas: many sprites in one SD file behind an index table
+ *
+ * Each SD.open costs a directory walk and FAT lookups that dwarf the read of
+ * a small sprite. An atlas is opened once, its table read into RAM, and every
+ * sprite after that is a seek plus a read. Files are built by
+ * tools/pack_atlas.py; sprites are found by FNV-1a hash of their name.
+ */
+
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <Arduino.h>
+#include <SD.h>
+
+enum AtlasFormat : uint8_t
+{
+    ATLAS_RGB565 = 0, // raw w*h RGB565 pixels
+    ATLAS_RLE565 = 1, // .rle565 file (RLESprite.h)
+    ATLAS_IDX8 = 2    // .idx8 file (IndexedImage.h)
+};
+
+struct AtlasEntry
+{
+    uint32_t hash;
+    uint32_t offset;
+    uint32_t size;
+    uint16_t width, height;
+    uint8_t format;
+};
+
+class SpriteAtlas
+{
+public:
+    ~SpriteAtlas() { close(); }
+
+    // Opens the atlas and reads its table. Returns false on any error.
+    bool open(const char *filepath);
+    void close();
+    bool isOpen() const { return entries != nullptr; }
+
+    const AtlasEntry *find(const char *name, uint8_t format = ATLAS_RGB565) const;
+
+    // Reads a sprite's payload; size must match the entry
+    bool read(const AtlasEntry &entry, void *dest, size_t size);
+
+    // Looks up a raw RGB565 sprite and reads it, like loadRGB565FromSD
+    bool loadRGB565(const char *name, uint16_t *buffer, size_t expectedSize);
+
+    uint16_t entryCount() const { return count; }
+    const AtlasEntry &entry(int i) const { return entries[i]; }
+
+    static uint32_t hashName(const char *name);
+
+private:
+    File file;
+    AtlasEntry *entries = nullptr;
+    uint16_t count = 0;
+};
+
+#endif // SPRITE_ATLAS_H
@@ -0,0 +1,146 @@
+/*
+ * Queued sprite pushes on the ESP-IDF SPI master driver
+ */
+
+#include "SpriteBatch.h"
+#include "CYD_Config.h"
+#include <driver/gpio.h>
+
+// The SPI peripheral TFT_eSPI drives the panel on
+#ifdef USE_HSPI_PORT
+#define SPRITE_BATCH_HOST HSPI_HOST
+#else
+#define SPRITE_BATCH_HOST VSPI_HOST
+#endif
+
+// Descriptor slots within a sprite's six transactions
+#define SLOT_COLUMNS 1
+#define SLOT_ROWS 3
+#define SLOT_PIXELS 5
+
+// Runs from the SPI interrupt before each transaction: commands go out with
+// DC low, everything else with DC high. The level travels in t->user.
+static void IRAM_ATTR setDataCommand(spi_transaction_t *t)
+{
+    gpio_set_level((gpio_num_t)TFT_DC, (uint32_t)(uintptr_t)t->user);
+}
+
+static void setRange(spi_transaction_t &t, int32_t first, int32_t last)
+{
+    t.tx_data[0] = first >> 8;
+    t.tx_data[1] = first & 0xFF;
+    t.tx_data[2] = last >> 8;
+    t.tx_data[3] = last & 0xFF;
+}
+
+bool SpriteBatch::begin(TFT_eSPI &tft, int maxSprites, uint32_t hz)
+{
+    end();
+    int count = maxSprites * SPRITE_BATCH_TRANS;
+    trans = (spi_transaction_t *)calloc(count, sizeof(spi_transaction_t));
+    if (!trans)
+        return false;
+
+    // Same wiring as TFT_eSPI's own DMA device: mode 0, and CS left to
+    // TFT_eSPI, which holds it low from startWrite() to endWrite()
+    spi_device_interface_config_t config = {};
+    config.mode = 0;
+    config.clock_speed_hz = hz;
+    config.spics_io_num = -1;
+    config.flags = SPI_DEVICE_NO_DUMMY;
+    config.queue_size = count;
+    config.pre_cb = setDataCommand;
+    if (spi_bus_add_device(SPRITE_BATCH_HOST, &config, &device) != ESP_OK)
+    {
+        device = nullptr;
+        free(trans);
+        trans = nullptr;
+        return false;
+    }
+
+    // Everything but the window and the pixel pointer is fixed: commands are
+    // one inline byte, window ranges four inline bytes
+    static const uint8_t commands[3] = {TFT_CASET, TFT_PASET, TFT_RAMWR};
+    for (int i = 0; i < count; i++)
+    {
+        spi_transaction_t &t = trans[i];
+        int slot = i % SPRITE_BATCH_TRANS;
+        if (slot == SLOT_PIXELS)
+        {
+            t.user = (void *)1;
+        }
+        else if (slot % 2 == 0)
+        {
+            t.flags = SPI_TRANS_USE_TXDATA;
+            t.length = 8;
+            t.tx_data[0] = commands[slot / 2];
+            t.user = (void *)0;
+        }
+        else
+        {
+            t.flags = SPI_TRANS_USE_TXDATA;
+            t.length = 32;
+            t.user = (void *)1;
+        }
+    }
+
+    display = &tft;
+    capacity = maxSprites;
+    queued = 0;
+    return true;
+}
+
+void SpriteBatch::end()
+{
+    wait();
+    if (device)
+        spi_bus_remove_device(device);
+    device = nullptr;
+    free(trans);
+    trans = nullptr;
+    capacity = 0;
+}
+
+bool SpriteBatch::push(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+    if (!device || queued >= capacity || x < 0 || x + w > display->width())
+        return false;
+
+    // Rows clip by starting later in the image and sending fewer of them
+    int32_t top = y < 0 ? -y : 0;
+    int32_t bottom = y + h > display->height() ? display->height() - y : h;
+    if (w <= 0 || bottom <= top)
+        return true;
+
+    if (queued == 0)
+        display->startWrite();
+
+    spi_transaction_t *t = trans + queued * SPRITE_BATCH_TRANS;
+    setRange(t[SLOT_COLUMNS], x, x + w - 1);
+    setRange(t[SLOT_ROWS], y + top, y + bottom - 1);
+    t[SLOT_PIXELS].tx_buffer = data + top * w;
+    t[SLOT_PIXELS].length = (size_t)(bottom - top) * w * 16;
+
+    for (int i = 0; i < SPRITE_BATCH_TRANS; i++)
+        spi_device_queue_trans(device, &t[i], portMAX_DELAY);
+    queued++;
+    return true;
+}
+
+uint32_t SpriteBatch::wait()
+{
+    if (queued == 0)
+        return 0;
+
+    unsigned long start = micros();
+    spi_transaction_t *done;
+    for (int i = 0; i < queued * SPRITE_BATCH_TRANS; i++)
+        spi_device_get_trans_result(device, &done, portMAX_DELAY);
+    queued = 0;
+
+    // drawPixel() skips CASET/RASET while its cached window still matches;
+    // any window set through TFT_eSPI drops that cache
+    display->setWindow(0, 0, 0, 0);
+    display->endWrite();
+    return micros() - start;
+}
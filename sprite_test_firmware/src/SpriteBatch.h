@@ -0,0 +1,55 @@
+/*
+ * Queued sprite pushes on the ESP-IDF SPI master driver
+ *
+ * pushImage() is one blocking transaction per sprite: the CPU sends the
+ * address window, clocks out every pixel and only then moves on. A batch
+ * instead queues each sprite as six transactions on its own device on the
+ * display bus (CASET, columns, RASET, rows, RAMWR, pixels), the command/data
+ * sequence of the IDF LCD example, with DC set by a pre-transfer callback.
+ * The descriptors are built once in begin() and a push only patches the
+ * coordinates and pixel pointer, so the CPU queues a frame's sprites and
+ * goes on with the next frame while DMA drains the queue.
+ *
+ * Pixels go out as they are in memory: images must already be in panel
+ * byte order (big-endian RGB565) and in DMA-capable RAM.
+ */
+
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <TFT_eSPI.h>
+#include <driver/spi_master.h>
+
+// Transactions queued per sprite
+#define SPRITE_BATCH_TRANS 6
+
+class SpriteBatch
+{
+public:
+    // Adds the batch device to the display bus, which TFT_eSPI must have
+    // set up for DMA (initDMA()). Up to maxSprites pushes fit in one batch.
+    // Returns false if out of memory or the driver rejects the device.
+    bool begin(TFT_eSPI &tft, int maxSprites, uint32_t hz = SPI_FREQUENCY);
+    void end();
+
+    // Queues one image; the first push of a batch claims the bus with
+    // startWrite(). Images running off the top or bottom are clipped.
+    // Returns false without queuing if the image crosses the left or right
+    // edge or the batch is full, so the caller can draw it another way.
+    bool push(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+
+    // Collects every queued transfer and releases the bus; nothing else may
+    // draw before this. Returns the microseconds spent waiting.
+    uint32_t wait();
+
+    int getQueued() const { return queued; }
+
+private:
+    TFT_eSPI *display = nullptr;
+    spi_device_handle_t device = nullptr;
+    spi_transaction_t *trans = nullptr;
+    int capacity = 0;
+    int queued = 0;
+};
+
+#endif // SPRITE_BATCH_H
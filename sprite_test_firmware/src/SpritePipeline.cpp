@@ -0,0 +1,164 @@
+/*
+ * Two-core sprite pipeline
+ */
+
+#include "SpritePipeline.h"
+
+bool SpritePipeline::begin(const Sprite *initial, int count, int16_t maxX, int16_t maxY,
+                           const PipelineAsset *assets, int numAssets, size_t maxImageBytes,
+                           AssetLoader loader, uint32_t loadInterval, bool runThreaded)
+{
+    if (count > PIPELINE_MAX_SPRITES)
+        count = PIPELINE_MAX_SPRITES;
+    memcpy(sprites, initial, count * sizeof(Sprite));
+    spriteCount = count;
+    boundX = maxX;
+    boundY = maxY;
+    assetList = assets;
+    assetCount = numAssets;
+    nextAsset = 0;
+    load = loader;
+    interval = loadInterval > 0 ? loadInterval : 1;
+    threaded = runThreaded;
+    spareImage = nullptr;
+    frames = 0;
+    loads = 0;
+    loadFailures = 0;
+    producerStalls = 0;
+
+    for (int i = 0; i < PIPELINE_IMAGE_BUFFERS; i++)
+    {
+        images[i] = (uint16_t *)malloc(maxImageBytes);
+        if (!images[i])
+        {
+            end();
+            return false;
+        }
+        freeImages.push(images[i]);
+    }
+
+    if (!threaded)
+        return true;
+
+    running = true;
+    finished = false;
+    if (xTaskCreatePinnedToCore(loaderTask, "loader", 4096, this, 1, nullptr, 0) != pdPASS)
+    {
+        running = false;
+        finished = true;
+        end();
+        return false;
+    }
+    return true;
+}
+
+// One loader step: stream the next asset when one is due, then advance the
+// game logic by a frame. Returns false if the ring had no room.
+bool SpritePipeline::produce()
+{
+    uint32_t frame = frames.load(std::memory_order_relaxed);
+    bool loadDue = assetCount > 0 && frame % interval == 0;
+    if (commands.space() < (loadDue ? 2u : 1u))
+        return false;
+
+    // The free ring is the renderer's to push to, so a buffer from a failed
+    // load is kept here for the next one
+    uint16_t *image = spareImage;
+    if (loadDue && (image || freeImages.pop(image)))
+    {
+        spareImage = nullptr;
+        const PipelineAsset &asset = assetList[nextAsset];
+        nextAsset = (nextAsset + 1) % assetCount;
+
+        if (load(asset.path, image, (size_t)asset.width * asset.height * 2))
+        {
+            PipelineCommand cmd;
+            cmd.type = PIPELINE_SPRITE;
+            cmd.count = 0;
+            cmd.width = asset.width;
+            cmd.height = asset.height;
+            cmd.image = image;
+            commands.push(cmd);
+            loads.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            spareImage = image;
+            loadFailures.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    PipelineCommand cmd;
+    cmd.type = PIPELINE_FRAME;
+    cmd.count = spriteCount;
+    cmd.image = nullptr;
+    for (int i = 0; i < spriteCount; i++)
+    {
+        moveSprite(sprites[i], boundX, boundY);
+        cmd.sprites[i] = sprites[i];
+    }
+    commands.push(cmd);
+    frames.store(frame + 1, std::memory_order_relaxed);
+    return true;
+}
+
+void SpritePipeline::loaderTask(void *param)
+{
+    SpritePipeline *pipeline = (SpritePipeline *)param;
+    while (pipeline->running.load(std::memory_order_acquire))
+    {
+        if (!pipeline->produce())
+        {
+            pipeline->producerStalls.fetch_add(1, std::memory_order_relaxed);
+            vTaskDelay(1);
+        }
+    }
+    pipeline->finished.store(true, std::memory_order_release);
+    vTaskDelete(NULL);
+}
+
+bool SpritePipeline::next(PipelineCommand &cmd)
+{
+    if (!threaded && commands.empty())
+        produce();
+    return commands.pop(cmd);
+}
+
+PipelineStats SpritePipeline::getStats() const
+{
+    PipelineStats stats;
+    stats.frames = frames.load(std::memory_order_relaxed);
+    stats.loads = loads.load(std::memory_order_relaxed);
+    stats.loadFailures = loadFailures.load(std::memory_order_relaxed);
+    stats.producerStalls = producerStalls.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SpritePipeline::release(uint16_t *image)
+{
+    if (image)
+        freeImages.push(image);
+}
+
+void SpritePipeline::end()
+{
+    running.store(false, std::memory_order_release);
+    while (!finished.load(std::memory_order_acquire))
+        delay(1);
+
+    // Drop anything still queued; the buffers are freed below either way
+    PipelineCommand cmd;
+    while (commands.pop(cmd))
+    {
+    }
+    uint16_t *image;
+    while (freeImages.pop(image))
+    {
+    }
+    spareImage = nullptr;
+    for (int i = 0; i < PIPELINE_IMAGE_BUFFERS; i++)
+    {
+        free(images[i]);
+        images[i] = nullptr;
+    }
+}
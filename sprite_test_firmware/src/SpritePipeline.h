@@ -0,0 +1,113 @@
+/*
+ * Two-core sprite pipeline: asset I/O and game logic feeding a renderer
+ *
+ * A loader task pinned to core 0 moves the sprites and streams sprite
+ * images from SD into a small buffer pool, and hands both to the renderer
+ * (the Arduino loop on core 1) through a lock-free command ring. The
+ * renderer never touches SD, so a slow read no longer holds up a frame; it
+ * only has to keep the ring from running dry. Image buffers go back to the
+ * loader through a second ring once the renderer has switched away from
+ * them. Each ring keeps a single producer: a buffer whose load failed
+ * stays with the loader for its next load instead of going back through
+ * the free ring, which only the renderer pushes to.
+ *
+ * Started with threaded = false, the same loader steps run inline in
+ * next() whenever the ring is empty, which is the single-core baseline.
+ */
+
+#ifndef SPRITE_PIPELINE_H
+#define SPRITE_PIPELINE_H
+
+#include <Arduino.h>
+#include <SpscRing.h>
+#include <atomic>
+#include "Sprite.h"
+#include "AssetCache.h"
+
+#define PIPELINE_MAX_SPRITES 16
+#define PIPELINE_RING_SIZE 8
+#define PIPELINE_IMAGE_BUFFERS 3
+
+struct PipelineAsset
+{
+    const char *path;
+    int16_t width, height;
+};
+
+enum PipelineCommandType : uint8_t
+{
+    PIPELINE_FRAME,  // sprites holds the positions for the next frame
+    PIPELINE_SPRITE  // image is a newly loaded sprite, owned by the renderer
+};
+
+struct PipelineCommand
+{
+    uint8_t type;
+    uint8_t count;
+    int16_t width, height;
+    uint16_t *image;
+    Sprite sprites[PIPELINE_MAX_SPRITES];
+};
+
+struct PipelineStats
+{
+    uint32_t frames;         // frame commands produced
+    uint32_t loads;          // sprite images streamed
+    uint32_t loadFailures;
+    uint32_t producerStalls; // loader found the ring full
+};
+
+class SpritePipeline
+{
+public:
+    // Sprites bounce inside [0, maxX] x [0, maxY]. Every loadInterval
+    // frames the next asset (round robin) is streamed in; assets must fit
+    // in maxImageBytes. Returns false if a buffer or the task can't be made.
+    bool begin(const Sprite *initial, int count, int16_t maxX, int16_t maxY,
+               const PipelineAsset *assets, int assetCount, size_t maxImageBytes,
+               AssetLoader loader, uint32_t loadInterval, bool threaded);
+
+    // Renderer side: next command, or false if none is ready yet
+    bool next(PipelineCommand &cmd);
+
+    // Renderer side: hand back an image from a PIPELINE_SPRITE command
+    void release(uint16_t *image);
+
+    // Stops the loader task, waits for it and frees the buffers
+    void end();
+
+    // Safe from either core while the loader runs; each counter is read
+    // atomically, though the four aren't one snapshot
+    PipelineStats getStats() const;
+
+private:
+    bool produce();
+    static void loaderTask(void *param);
+
+    SpscRing<PipelineCommand, PIPELINE_RING_SIZE> commands;
+    SpscRing<uint16_t *, PIPELINE_IMAGE_BUFFERS + 1> freeImages;
+    uint16_t *images[PIPELINE_IMAGE_BUFFERS] = {};
+    uint16_t *spareImage = nullptr; // loader side, left over from a failed load
+
+    Sprite sprites[PIPELINE_MAX_SPRITES];
+    int spriteCount = 0;
+    int16_t boundX = 0, boundY = 0;
+
+    const PipelineAsset *assetList = nullptr;
+    int assetCount = 0;
+    int nextAsset = 0;
+    AssetLoader load = nullptr;
+    uint32_t interval = 1;
+
+    bool threaded = false;
+    std::atomic<bool> running{false};
+    std::atomic<bool> finished{true};
+
+    // Written by the loader task, read by the renderer through getStats()
+    std::atomic<uint32_t> frames{0};
+    std::atomic<uint32_t> loads{0};
+    std::atomic<uint32_t> loadFailures{0};
+    std::atomic<uint32_t> producerStalls{0};
+};
+
+#endif // SPRITE_PIPELINE_H
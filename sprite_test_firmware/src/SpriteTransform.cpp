@@ -0,0 +1,231 @@
+/*
+ * Mirrored, scaled and rotated sprite blits
+ */
+
+#include "SpriteTransform.h"
+#include <math.h>
+
+// Destination box and where its pixels come from: column c of row r
+// samples source (u0 + c * dux + r * duy, v0 + c * dvx + r * dvy), all 16.16
+struct BlitMapping
+{
+    int32_t x, y, w, h;
+    int32_t u0, v0;
+    int32_t dux, dvx, duy, dvy;
+    bool axisAligned; // rows map to source rows and stay inside the image
+};
+
+// ============================================================================
+// MAPPINGS
+// ============================================================================
+
+static BlitMapping scaledMapping(int32_t x, int32_t y, int16_t w, int16_t h, int32_t scale, bool flip)
+{
+    BlitMapping m = {};
+    m.x = x;
+    m.y = y;
+    m.w = (int32_t)(((int64_t)w * scale + TRANSFORM_ONE / 2) >> 16);
+    m.h = (int32_t)(((int64_t)h * scale + TRANSFORM_ONE / 2) >> 16);
+    if (m.w <= 0 || m.h <= 0)
+    {
+        m.w = m.h = 0;
+        return m;
+    }
+
+    // Steps chosen so the box covers the image exactly, sampling pixel
+    // centres; mirrored rows start just inside the right edge
+    int32_t stepU = (int32_t)(((int64_t)w << 16) / m.w);
+    int32_t stepV = (int32_t)(((int64_t)h << 16) / m.h);
+    m.u0 = flip ? ((int32_t)w << 16) - stepU / 2 - 1 : stepU / 2;
+    m.v0 = stepV / 2;
+    m.dux = flip ? -stepU : stepU;
+    m.dvy = stepV;
+    m.axisAligned = true;
+    return m;
+}
+
+static BlitMapping rotatedMapping(int32_t cx, int32_t cy, int16_t w, int16_t h, float degrees, int32_t scale)
+{
+    BlitMapping m = {};
+    float s = scale / (float)TRANSFORM_ONE;
+    if (s <= 0)
+        return m;
+    float c = cosf(degrees * (float)M_PI / 180.0f);
+    float n = sinf(degrees * (float)M_PI / 180.0f);
+
+    // Bounding box of the rotated image around (cx, cy)
+    float halfW = (fabsf(c) * w + fabsf(n) * h) * s / 2;
+    float halfH = (fabsf(n) * w + fabsf(c) * h) * s / 2;
+    m.x = (int32_t)floorf(cx - halfW);
+    m.y = (int32_t)floorf(cy - halfH);
+    m.w = (int32_t)ceilf(cx + halfW) - m.x;
+    m.h = (int32_t)ceilf(cy + halfH) - m.y;
+
+    // Inverse rotation: screen steps back into the image, which is
+    // centred on (cx, cy)
+    m.dux = (int32_t)lroundf(c / s * TRANSFORM_ONE);
+    m.dvx = (int32_t)lroundf(-n / s * TRANSFORM_ONE);
+    m.duy = (int32_t)lroundf(n / s * TRANSFORM_ONE);
+    m.dvy = (int32_t)lroundf(c / s * TRANSFORM_ONE);
+    float dx = m.x + 0.5f - cx;
+    float dy = m.y + 0.5f - cy;
+    m.u0 = (int32_t)lroundf(((c * dx + n * dy) / s + w / 2.0f) * TRANSFORM_ONE);
+    m.v0 = (int32_t)lroundf(((-n * dx + c * dy) / s + h / 2.0f) * TRANSFORM_ONE);
+    m.axisAligned = false;
+    return m;
+}
+
+// ============================================================================
+// SAMPLING
+// ============================================================================
+
+// Writes the pixels of box row `row`, columns [c0, c1), to out[0..c1-c0).
+// Columns that fall outside the image are left alone; the written ones
+// are always a single run, returned as its start and length.
+static int32_t sampleRow(const BlitMapping &m, const uint16_t *image, int16_t w, int16_t h,
+                         int32_t row, int32_t c0, int32_t c1, uint16_t *out, int32_t &first)
+{
+    int32_t u = m.u0 + c0 * m.dux + row * m.duy;
+    int32_t v = m.v0 + c0 * m.dvx + row * m.dvy;
+
+    if (m.axisAligned)
+    {
+        const uint16_t *src = image + (v >> 16) * w;
+        first = 0;
+        if (m.dux == -TRANSFORM_ONE)
+        {
+            // Plain mirror: walk the source row backwards
+            src += u >> 16;
+            for (int32_t i = 0; i < c1 - c0; i++)
+                out[i] = *src--;
+        }
+        else
+        {
+            for (int32_t i = 0; i < c1 - c0; i++)
+            {
+                out[i] = src[u >> 16];
+                u += m.dux;
+            }
+        }
+        return c1 - c0;
+    }
+
+    // Rotated: the row crosses the image in one run, if at all
+    uint32_t limitU = (uint32_t)w << 16, limitV = (uint32_t)h << 16;
+    int32_t count = 0;
+    first = 0;
+    for (int32_t i = 0; i < c1 - c0; i++)
+    {
+        if ((uint32_t)u < limitU && (uint32_t)v < limitV)
+        {
+            if (count == 0)
+                first = i;
+            out[i] = image[(v >> 16) * w + (u >> 16)];
+            count++;
+        }
+        else if (count)
+        {
+            break;
+        }
+        u += m.dux;
+        v += m.dvx;
+    }
+    return count;
+}
+
+// ============================================================================
+// TARGETS
+// ============================================================================
+
+static void blitMapping(uint16_t *dest, int16_t destW, int16_t destH, const BlitMapping &m,
+                        const uint16_t *image, int16_t w, int16_t h)
+{
+    int32_t c0 = max((int32_t)0, -m.x), c1 = min(m.w, (int32_t)(destW - m.x));
+    int32_t r0 = max((int32_t)0, -m.y), r1 = min(m.h, (int32_t)(destH - m.y));
+    if (c0 >= c1 || r0 >= r1)
+        return;
+
+    int32_t first;
+    for (int32_t row = r0; row < r1; row++)
+        sampleRow(m, image, w, h, row, c0, c1, dest + (m.y + row) * destW + m.x + c0, first);
+}
+
+// Pushes the mapped image, clipped to the screen and to the clip rectangle
+static void pushMapping(TFT_eSPI &tft, const BlitMapping &m, const uint16_t *image, int16_t w, int16_t h,
+                        int32_t clipX = 0, int32_t clipY = 0, int32_t clipW = INT16_MAX, int32_t clipH = INT16_MAX)
+{
+    int32_t left = max(clipX, (int32_t)0), right = min(clipX + clipW, (int32_t)tft.width());
+    int32_t top = max(clipY, (int32_t)0), bottom = min(clipY + clipH, (int32_t)tft.height());
+    int32_t c0 = max((int32_t)0, left - m.x), c1 = min(m.w, right - m.x);
+    int32_t r0 = max((int32_t)0, top - m.y), r1 = min(m.h, bottom - m.y);
+    c1 = min(c1, (int32_t)(c0 + TRANSFORM_LINE_MAX));
+    if (c0 >= c1 || r0 >= r1)
+        return;
+
+    uint16_t line[TRANSFORM_LINE_MAX];
+    int32_t first;
+    tft.startWrite();
+    if (m.axisAligned)
+    {
+        // Every row is full: one window for the whole sprite
+        tft.setAddrWindow(m.x + c0, m.y + r0, c1 - c0, r1 - r0);
+        for (int32_t row = r0; row < r1; row++)
+        {
+            sampleRow(m, image, w, h, row, c0, c1, line, first);
+            tft.pushPixels(line, c1 - c0);
+        }
+    }
+    else
+    {
+        for (int32_t row = r0; row < r1; row++)
+        {
+            int32_t count = sampleRow(m, image, w, h, row, c0, c1, line, first);
+            if (count == 0)
+                continue;
+            tft.setAddrWindow(m.x + c0 + first, m.y + row, count, 1);
+            tft.pushPixels(line + first, count);
+        }
+    }
+    tft.endWrite();
+}
+
+void blitFlipped(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                 const uint16_t *image, int16_t w, int16_t h)
+{
+    blitMapping(dest, destW, destH, scaledMapping(x, y, w, h, TRANSFORM_ONE, true), image, w, h);
+}
+
+void blitScaled(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                const uint16_t *image, int16_t w, int16_t h, int32_t scale, bool flip)
+{
+    blitMapping(dest, destW, destH, scaledMapping(x, y, w, h, scale, flip), image, w, h);
+}
+
+void blitRotated(uint16_t *dest, int16_t destW, int16_t destH, int32_t cx, int32_t cy,
+                 const uint16_t *image, int16_t w, int16_t h, float degrees, int32_t scale)
+{
+    blitMapping(dest, destW, destH, rotatedMapping(cx, cy, w, h, degrees, scale), image, w, h);
+}
+
+void pushImageFlipped(TFT_eSPI &tft, int32_t x, int32_t y, int16_t w, int16_t h, const uint16_t *image)
+{
+    pushMapping(tft, scaledMapping(x, y, w, h, TRANSFORM_ONE, true), image, w, h);
+}
+
+void pushImageFlipped(TFT_eSPI &tft, int32_t x, int32_t y, int16_t w, int16_t h, const uint16_t *image,
+                      int32_t clipX, int32_t clipY, int32_t clipW, int32_t clipH)
+{
+    pushMapping(tft, scaledMapping(x, y, w, h, TRANSFORM_ONE, true), image, w, h, clipX, clipY, clipW, clipH);
+}
+
+void pushImageScaled(TFT_eSPI &tft, int32_t x, int32_t y, int16_t w, int16_t h, const uint16_t *image,
+                     int32_t scale, bool flip)
+{
+    pushMapping(tft, scaledMapping(x, y, w, h, scale, flip), image, w, h);
+}
+
+void pushImageRotated(TFT_eSPI &tft, int32_t cx, int32_t cy, int16_t w, int16_t h, const uint16_t *image,
+                      float degrees, int32_t scale)
+{
+    pushMapping(tft, rotatedMapping(cx, cy, w, h, degrees, scale), image, w, h);
+}
@@ -0,0 +1,49 @@
+/*
+ * Mirrored, scaled and rotated sprite blits
+ *
+ * Facing a sprite the other way or zooming it used to need a second copy
+ * of the image. These blits read the source image through a 16.16 fixed
+ * point mapping instead, writing each output pixel once: straight into a
+ * RAM buffer (a compositor band or a TFT_eSprite's getPointer()), or to
+ * the panel a row at a time through a line buffer on the stack. Nothing
+ * is allocated.
+ *
+ * Sampling is nearest neighbour. Rotation only costs floating point once
+ * per call, to set up the steps; rotated rows are pushed as one window per
+ * row, covering just the pixels inside the image, so whatever is already
+ * on screen around the sprite stays as it was.
+ */
+
+#ifndef SPRITE_TRANSFORM_H
+#define SPRITE_TRANSFORM_H
+
+#include <TFT_eSPI.h>
+
+// Scale factors are 16.16 fixed point
+#define TRANSFORM_ONE 65536
+
+// Widest row pushed to the panel (the line buffer, on the stack)
+#define TRANSFORM_LINE_MAX 320
+
+// RAM targets: the image is drawn into a destW x destH buffer of the same
+// pixel format, clipped to it. x, y is the top-left corner of the drawn
+// sprite; for rotation cx, cy is where the image centre lands.
+void blitFlipped(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                 const uint16_t *image, int16_t w, int16_t h);
+void blitScaled(uint16_t *dest, int16_t destW, int16_t destH, int32_t x, int32_t y,
+                const uint16_t *image, int16_t w, int16_t h, int32_t scale, bool flip = false);
+void blitRotated(uint16_t *dest, int16_t destW, int16_t destH, int32_t cx, int32_t cy,
+                 const uint16_t *image, int16_t w, int16_t h, float degrees, int32_t scale = TRANSFORM_ONE);
+
+// Panel targets, clipped to the screen; same byte order as pushImage()
+void pushImageFlipped(TFT_eSPI &tft, int32_t x, int32_t y, int16_t w, int16_t h, const uint16_t *image);
+// Only the part inside the clip rectangle; a TFT_eSPI viewport doesn't clip
+// the raw window pushes these use
+void pushImageFlipped(TFT_eSPI &tft, int32_t x, int32_t y, int16_t w, int16_t h, const uint16_t *image,
+                      int32_t clipX, int32_t clipY, int32_t clipW, int32_t clipH);
+void pushImageScaled(TFT_eSPI &tft, int32_t x, int32_t y, int16_t w, int16_t h, const uint16_t *image,
+                     int32_t scale, bool flip = false);
+void pushImageRotated(TFT_eSPI &tft, int32_t cx, int32_t cy, int16_t w, int16_t h, const uint16_t *image,
+                      float degrees, int32_t scale = TRANSFORM_ONE);
+
+#endif // SPRITE_TRANSFORM_H
@@ -0,0 +1,88 @@
+/*
+ * Streaming RGB565 loader with ping-pong DMA pushes
+ */
+
+#include "StreamLoader.h"
+#include <SD.h>
+
+bool streamRGB565FromSD(TFT_eSPI &tft, const char *filepath, int32_t x, int32_t y,
+                        int16_t w, int16_t h, int16_t chunkRows, StreamStats *stats)
+{
+    unsigned long start = micros();
+
+    if (chunkRows <= 0)
+    {
+        Serial.println("Stream chunk must be at least one row");
+        return false;
+    }
+
+    File file = SD.open(filepath);
+    if (!file)
+    {
+        Serial.print("Failed to open: ");
+        Serial.println(filepath);
+        return false;
+    }
+
+    size_t expectedSize = (size_t)w * h * 2;
+    if (file.size() != expectedSize)
+    {
+        Serial.print("Size mismatch: ");
+        Serial.print(file.size());
+        Serial.print(" vs ");
+        Serial.println(expectedSize);
+        file.close();
+        return false;
+    }
+
+    size_t chunkBytes = (size_t)w * chunkRows * 2;
+    uint16_t *buffers[2];
+    buffers[0] = (uint16_t *)malloc(chunkBytes);
+    buffers[1] = (uint16_t *)malloc(chunkBytes);
+    if (!buffers[0] || !buffers[1])
+    {
+        Serial.println("Stream buffer allocation failed!");
+        free(buffers[0]);
+        free(buffers[1]);
+        file.close();
+        return false;
+    }
+
+    unsigned long firstPixel = 0;
+    bool ok = true;
+    int next = 0;
+
+    tft.startWrite();
+    for (int16_t row = 0; row < h; row += chunkRows)
+    {
+        int16_t rows = min(chunkRows, (int16_t)(h - row));
+        size_t bytes = (size_t)w * rows * 2;
+
+        // This buffer was last pushed two chunks ago; pushImageDMA waits for
+        // the previous transfer before starting, so that one has finished
+        if (file.read((uint8_t *)buffers[next], bytes) != bytes)
+        {
+            ok = false;
+            break;
+        }
+
+        tft.pushImageDMA(x, y + row, w, rows, buffers[next]);
+        if (row == 0)
+            firstPixel = micros() - start;
+        next ^= 1;
+    }
+    tft.dmaWait();
+    tft.endWrite();
+
+    file.close();
+    free(buffers[0]);
+    free(buffers[1]);
+
+    if (stats)
+    {
+        stats->firstPixelUs = firstPixel;
+        stats->totalUs = micros() - start;
+        stats->peakBytes = chunkBytes * 2;
+    }
+    return ok;
+}
@@ -0,0 +1,29 @@
+/*
+ * Streaming RGB565 loader: reads a raw image from SD in chunks of rows and
+ * pushes each chunk to its screen window while the next one is read
+ *
+ * Two small ping-pong buffers replace the full-size destination buffer, and
+ * because the SD card (VSPI) and the display (HSPI) are separate buses the
+ * DMA push of one chunk overlaps the file read of the next. The first rows
+ * appear after one chunk read instead of after the whole file.
+ */
+
+#ifndef STREAM_LOADER_H
+#define STREAM_LOADER_H
+
+#include <TFT_eSPI.h>
+
+struct StreamStats
+{
+    unsigned long firstPixelUs; // call to first chunk on the wire
+    unsigned long totalUs;      // call to last chunk on the panel
+    size_t peakBytes;           // ping-pong buffers allocated
+};
+
+// Streams a w x h .rgb565 file to (x, y), chunkRows rows at a time. DMA must
+// be initialised (tft.initDMA()). Returns false if chunkRows is not positive,
+// the file is missing or the wrong size, or the buffers cannot be allocated.
+bool streamRGB565FromSD(TFT_eSPI &tft, const char *filepath, int32_t x, int32_t y,
+                        int16_t w, int16_t h, int16_t chunkRows, StreamStats *stats = nullptr);
+
+#endif // STREAM_LOADER_H
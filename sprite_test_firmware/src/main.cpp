@@ -14,6 +14,32 @@
 #include <SPI.h>
 #include <SD.h>
 #include <PNGdec.h>
+#include <TouchInput.h>
+#include <SpiSweep.h>
+#include "CYD_Config.h"
+#include "Sprite.h"
+#include "DirtyRects.h"
+#include "BandCompositor.h"
+#include "RLESprite.h"
+#include "IndexedImage.h"
+#include "StreamLoader.h"
+#include "SpriteAtlas.h"
+#include "PngRows.h"
+#include "AssetCache.h"
+#include "Bench.h"
+#include "FrameProfiler.h"
+#include "SpritePipeline.h"
+#include "SpriteBatch.h"
+#include "EntityStore.h"
+#include "SpatialGrid.h"
+#include "HardwareScroll.h"
+#include "LzImage.h"
+#include "FlashImage.h"
+#include "FlashAssets.h"
+#include "AlphaSprite.h"
+#include "SpriteTransform.h"
+#include "Animation.h"
+#include "GlyphCache.h"
 
 // ============================================================================
 // HARDWARE CONFIGURATION
@@ -28,9 +54,6 @@ PNG png;
 #define SD_MISO 19
 #define SD_SCK 18
 
-// Touch pins (for future interactive tests)
-#define TOUCH_CS 33
-
 // Screen dimensions
 #define SCREEN_WIDTH 240
 #define SCREEN_HEIGHT 320
@@ -43,53 +66,153 @@ PNG png;
 #define BACKGROUND_WIDTH 240
 #define BACKGROUND_HEIGHT 240
 
+// Cached asset paths and sizes
+#define BLUEGILL_RGB565 "/sprite_tests/fish_bluegill_32x32.rgb565"
+#define BLUEGILL_BYTES (BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2)
+#define BACKGROUND_RGB565 "/sprite_tests/background_240x240.rgb565"
+#define BACKGROUND_BYTES (BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2)
+
+// Heap left outside the asset cache budget (stacks, DMA bands, decoders)
+#define ASSET_HEAP_RESERVE 65536
+
+// Rows per DMA band in the C2-DMA compositor (two bands are kept in RAM)
+#define C2_BAND_HEIGHT 32
+
+// Rows per chunk for the streaming loader in B1 (two chunks are kept in RAM)
+#define STREAM_CHUNK_ROWS 4
+
+// B7: display clocks to sweep (the ESP32 runs each at 80 MHz / n, at or
+// below it) and the height of the read-back pattern band
+#define SWEEP_STEPS 6
+const uint32_t sweepFreqs[SWEEP_STEPS] = {10000000, 20000000, 27000000, 40000000, 55000000, 80000000};
+#define SWEEP_BAND_HEIGHT 40
+
+// B8: entity counts for the update benchmark, and the lifetime range of
+// the churn pass (frames), where expired entities are replaced every frame
+#define ENTITY_STEPS 3
+const uint32_t entityCounts[ENTITY_STEPS] = {100, 1000, 5000};
+#define ENTITY_LIFE_MIN 30
+#define ENTITY_LIFE_MAX 120
+
+// B8: spawns drawn up front for the churn refill, used round robin
+#define ENTITY_SPAWN_TABLE 256
+
+// B8: entity updates per timed sample, so small counts still take long
+// enough for micros() to resolve
+#define ENTITY_SAMPLE_UPDATES 50000
+
+// B9: LZ-compressed copies of the raw assets (tools/lz_compress.py)
+#define BLUEGILL_LZ565 "/sprite_tests/fish_bluegill_32x32.lz565"
+#define BLUEGILL_LZI8 "/sprite_tests/fish_bluegill_32x32.lzi8"
+#define BACKGROUND_LZ565 "/sprite_tests/background_240x240.lz565"
+#define BACKGROUND_LZI8 "/sprite_tests/background_240x240.lzi8"
+
+// B11: square the transformed fish are drawn and checked in, the rotation
+// angle, and RAM blits per timed sample (one is too quick for micros())
+#define TRANSFORM_AREA 100
+#define TRANSFORM_ANGLE 30
+#define TRANSFORM_BLITS_PER_SAMPLE 20
+
+// B12: smooth font for the glyph cache runs (tools/ttf_to_vlw.py), and the
+// spare corner of the screen glyphs are rendered in while the cache builds
+#define GLYPH_FONT_FILE "/sprite_tests/DejaVuSans15.vlw"
+#define GLYPH_SCRATCH_X 270
+#define GLYPH_SCRATCH_Y 195
+
+// C2-Alpha: the fish with its alpha channel kept (tools/png_to_a565.py)
+#define BLUEGILL_A565 "/sprite_tests/fish_bluegill_32x32.a565"
+
+// Benchmark harness: untimed warmup calls, then timed iterations per metric
+#define BENCH_WARMUP 5
+#define BENCH_ITERATIONS 50
+
+// SD loads pay a file open each (~14 ms on the CYD), so fewer of them
+#define LOAD_WARMUP 1
+#define LOAD_ITERATIONS 10
+
+// Result lines on Serial: BENCH_FORMAT_CSV or BENCH_FORMAT_JSON
+#define BENCH_OUTPUT BENCH_FORMAT_CSV
+
+// Frame time samples reserved per stress test step (grows if exceeded)
+#define FRAME_SAMPLES 512
+
+// Frame time histogram bin width for the C1/C2 phase profiler (128 bins)
+#define FRAME_HIST_BIN_US 500
+
+// C4: frames between streamed sprite loads, and how much longer than the
+// median a frame must take to count as a drop
+#define PIPELINE_LOAD_INTERVAL 4
+#define PIPELINE_DROP_FACTOR 1.5f
+
+// C5: sprite counts and size (bullets and small enemies; 500 fish would
+// cover the screen ten times over), grid cell size (1 << shift pixels),
+// frames and point/area queries per count, and the pair buffer size
+#define BROADPHASE_STEPS 3
+const int broadphaseCounts[BROADPHASE_STEPS] = {50, 200, 500};
+#define BROADPHASE_SIZE 16
+#define BROADPHASE_CELL_SHIFT 5
+#define BROADPHASE_FRAMES 60
+#define BROADPHASE_QUERIES 64
+#define BROADPHASE_MAX_PAIRS 2048
+
+// C6: fixed HUD strips at each end of the scroll axis (leaving a scroll
+// area the width of the background in landscape), lines scrolled per frame
+// and time per path
+#define SCROLL_HUD_LINES 40
+#define SCROLL_SPEED 2
+#define SCROLL_TEST_MS 3000
+
+// C7: the fish swim cycle in the atlas (tools/make_sheet.py), fish
+// animated at once and test length
+#define SWIM_SHEET "fish_bluegill_swim"
+#define ANIM_FISH 25
+#define ANIM_TEST_MS 5000
+
 // ============================================================================
 // GLOBAL BUFFERS AND STATE
 // ============================================================================
 
-// Sprite buffers
+// Scratch buffers for the loading/format tests, which overwrite them
 uint16_t *bluegillBuffer = nullptr;
 uint16_t *clankerBuffer = nullptr;
-uint16_t *backgroundBuffer = nullptr;
+
+// Assets the rendering tests draw, loaded once and shared between tests
+AssetCache assets;
+
+// Touch events from the IRQ-driven sampling task
+TouchInput touch;
 
 // Test state
 int currentTest = 0;
 bool testsComplete = false;
 
-// Performance tracking
-struct TestResult
-{
-    const char *name;
-    float value;
-    const char *unit;
-};
-
-TestResult results[20];
-int resultCount = 0;
-
 // Sprite positions for animation tests
-struct Sprite
-{
-    int16_t x, y;
-    int16_t dx, dy;
-    bool active;
-};
-
 Sprite sprites[25];
 
+// C7 clips over the swim sheet: frame index and milliseconds per step
+const AnimFrame swimFrames[] = {{0, 90}, {1, 90}, {2, 90}, {3, 90}};
+const AnimFrame idleFrames[] = {{0, 250}, {1, 180}, {2, 250}};
+const AnimFrame dartFrames[] = {{0, 40}, {2, 40}};
+const AnimClip fishClips[] = {
+    {"swim", swimFrames, 4, ANIM_LOOP},
+    {"idle", idleFrames, 3, ANIM_PING_PONG},
+    {"dart", dartFrames, 2, ANIM_LOOP},
+};
+#define FISH_CLIPS (sizeof(fishClips) / sizeof(fishClips[0]))
+
 // ============================================================================
 // UTILITY FUNCTIONS
 // ============================================================================
 
+// Results go to the benchmark harness, which prints each one on Serial
 void addResult(const char *name, float value, const char *unit)
 {
-    if (resultCount < 20)
-    {
-        results[resultCount].name = name;
-        results[resultCount].value = value;
-        results[resultCount].unit = unit;
-        resultCount++;
-    }
+    benchRecord(name, unit, benchSingle(value));
+}
+
+void addResult(const char *name, const BenchStats &stats, const char *unit)
+{
+    benchRecord(name, unit, stats);
 }
 
 void displayText(const char *text, int x, int y, uint16_t color = TFT_WHITE, int size = 2)
@@ -103,7 +226,9 @@ void displayText(const char *text, int x, int y, uint16_t color = TFT_WHITE, int
 void waitForTouch()
 {
     displayText("Tap screen to continue", 10, 280, TFT_YELLOW, 1);
-    delay(2000); // Auto-continue after 2 seconds for now
+    touch.flush();
+    TouchEvent tap;
+    touch.waitForTap(tap, 2000); // Auto-continue after 2 seconds without a tap
 }
 
 void clearScreen()
@@ -186,55 +311,37 @@ int32_t mySeek(PNGFILE *handle, int32_t position)
     return pngFile->seek(position);
 }
 
-// PNG decoder callback
+// Decode target: the converter and table are picked on the first row,
+// when PNGdec has parsed the palette
+struct PNGTarget
+{
+    uint16_t *buffer;
+    PngRowConverter convert;
+    uint16_t table[256];
+};
+
+// PNG decoder callback: rows go out as BGR565 (hardware native order for
+// CYD) with alpha composited onto BLACK
 int pngDraw(PNGDRAW *pDraw)
 {
-    uint16_t *buffer = (uint16_t *)pDraw->pUser;
-    uint16_t *row = buffer + (pDraw->y * pDraw->iWidth);
-
-    // PNGdec can provide pixels in various formats
-    // We'll handle the most common ones and composite onto BLACK
-    for (int x = 0; x < pDraw->iWidth; x++)
-    {
-        uint8_t r = 0, g = 0, b = 0, a = 255;
-        
-        if (pDraw->iBpp == 32) { // RGBA
-            r = pDraw->pPixels[x * 4];
-            g = pDraw->pPixels[x * 4 + 1];
-            b = pDraw->pPixels[x * 4 + 2];
-            a = pDraw->pPixels[x * 4 + 3];
-        } 
-        else if (pDraw->iBpp == 24) { // RGB
-            r = pDraw->pPixels[x * 3];
-            g = pDraw->pPixels[x * 3 + 1];
-            b = pDraw->pPixels[x * 3 + 2];
-        } 
-        else if (pDraw->iBpp == 8) { // Indexed
-            // For indexed, we'd need to look up the palette, but simpler 
-            // to just use the first 3 bytes if the library pre-expands it
-            // or use the library's built-in helper.
-            // For our fish assets (which are RGBA), iBpp will be 32.
-            r = pDraw->pPixels[x * 3];
-            g = pDraw->pPixels[x * 3 + 1];
-            b = pDraw->pPixels[x * 3 + 2];
-        }
-
-        // Alpha blending against BLACK background
-        // brightness = value * (alpha / 255)
-        if (a < 255) {
-            r = (uint16_t)r * a / 255;
-            g = (uint16_t)g * a / 255;
-            b = (uint16_t)b * a / 255;
-        }
-
-        // Convert to BGR565 (Hardware native order for CYD)
-        uint16_t r5 = (r >> 3) & 0x1F;
-        uint16_t g6 = (g >> 2) & 0x3F;
-        uint16_t b5 = (b >> 3) & 0x1F;
-        
-        // BGR565 packing: Bbbbb Gggggg Rrrrr
-        row[x] = (b5 << 11) | (g6 << 5) | r5;
+    PNGTarget *target = (PNGTarget *)pDraw->pUser;
+
+    if (pDraw->y == 0)
+    {
+        target->convert = pngRowConverter(pDraw->iPixelType, pDraw->iBpp);
+        if (!target->convert)
+        {
+            Serial.print("Unsupported PNG: type ");
+            Serial.print(pDraw->iPixelType);
+            Serial.print(", ");
+            Serial.print(pDraw->iBpp);
+            Serial.println(" bits");
+            return 0;
+        }
+        pngBuildRowTable(pDraw->iPixelType, pDraw->iBpp, pDraw->pPalette, pDraw->iHasAlpha, target->table);
     }
+
+    target->convert(pDraw->pPixels, target->buffer + pDraw->y * pDraw->iWidth, pDraw->iWidth, target->table);
     return 1; // Success
 }
 
@@ -248,8 +355,19 @@ bool loadPNGFromSD(const char *filepath, uint16_t *buffer, int width, int height
         Serial.println(rc);
         return false;
     }
+    if (png.getWidth() != width || png.getHeight() != height)
+    {
+        Serial.print("PNG size mismatch: ");
+        Serial.print(png.getWidth());
+        Serial.print("x");
+        Serial.println(png.getHeight());
+        png.close();
+        return false;
+    }
 
-    rc = png.decode(buffer, 0);
+    static PNGTarget target;
+    target.buffer = buffer;
+    rc = png.decode(&target, 0);
     png.close();
 
     Serial.print("Loaded PNG: ");
@@ -512,32 +630,95 @@ void testB1_LoadingSpeed()
     displayText("B1: Loading Speed", 10, 10, TFT_CYAN);
 
     // Test Bluegill loading
-    unsigned long pngStart = micros();
-    loadPNGFromSD("/sprite_tests/fish_bluegill_32x32.png", bluegillBuffer, BLUEGILL_WIDTH, BLUEGILL_HEIGHT);
-    unsigned long pngLoad = micros() - pngStart;
-
-    unsigned long rgbStart = micros();
-    loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
-    unsigned long rgbLoad = micros() - rgbStart;
+    BenchStats pngLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, []()
+                                  { loadPNGFromSD("/sprite_tests/fish_bluegill_32x32.png", bluegillBuffer, BLUEGILL_WIDTH, BLUEGILL_HEIGHT); });
+    BenchStats rgbLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, []()
+                                  { loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2); });
 
     char buf[50];
-    sprintf(buf, "PNG: %lu us", pngLoad);
+    sprintf(buf, "PNG: %.0f us", pngLoad.median);
     displayText(buf, 10, 50, TFT_WHITE);
 
-    sprintf(buf, "RGB565: %lu us", rgbLoad);
+    sprintf(buf, "RGB565: %.0f us", rgbLoad.median);
     displayText(buf, 10, 80, TFT_WHITE);
 
-    displayText(pngLoad < rgbLoad ? "PNG Faster" : "RGB565 Faster", 10, 110, TFT_YELLOW);
+    displayText(pngLoad.median < rgbLoad.median ? "PNG Faster" : "RGB565 Faster", 10, 110, TFT_YELLOW);
 
     addResult("B1_PNG_Load", pngLoad, "us");
     addResult("B1_RGB_Load", rgbLoad, "us");
 
-    Serial.print("PNG Load: ");
-    Serial.print(pngLoad);
+    Serial.print("PNG Load: median ");
+    Serial.print(pngLoad.median);
+    Serial.println(" us");
+    Serial.print("RGB565 Load: median ");
+    Serial.print(rgbLoad.median);
     Serial.println(" us");
-    Serial.print("RGB565 Load: ");
-    Serial.print(rgbLoad);
+
+    // Background to screen: whole-file load then push, vs streamed chunks
+    BenchSampler bufFirst(LOAD_ITERATIONS), bufTotal(LOAD_ITERATIONS);
+    BenchSampler streamFirst(LOAD_ITERATIONS), streamTotal(LOAD_ITERATIONS);
+    StreamStats stream = {0, 0, 0};
+    bool bufOk = true, streamOk = true;
+    tft.initDMA();
+    for (int i = 0; i < LOAD_ITERATIONS; i++)
+    {
+        unsigned long bufStart = micros();
+        uint16_t *fullBuffer = (uint16_t *)malloc(BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2);
+        bool ok = fullBuffer && loadRGB565FromSD("/sprite_tests/background_240x240.rgb565", fullBuffer, BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2);
+        bufFirst.add(micros() - bufStart);
+        if (ok)
+        {
+            tft.pushImage(0, 0, BACKGROUND_WIDTH, BACKGROUND_HEIGHT, fullBuffer);
+        }
+        bufTotal.add(micros() - bufStart);
+        free(fullBuffer);
+        bufOk &= ok;
+
+        streamOk &= streamRGB565FromSD(tft, "/sprite_tests/background_240x240.rgb565", 0, 0,
+                                       BACKGROUND_WIDTH, BACKGROUND_HEIGHT, STREAM_CHUNK_ROWS, &stream);
+        streamFirst.add(stream.firstPixelUs);
+        streamTotal.add(stream.totalUs);
+    }
+    tft.deInitDMA();
+
+    BenchStats bufFirstStats = bufFirst.stats(), bufTotalStats = bufTotal.stats();
+    BenchStats streamFirstStats = streamFirst.stats(), streamTotalStats = streamTotal.stats();
+
+    clearScreen();
+    displayText("B1: Loading Speed", 10, 10, TFT_CYAN);
+    sprintf(buf, "PNG: %.0f us", pngLoad.median);
+    displayText(buf, 10, 50, TFT_WHITE);
+    sprintf(buf, "RGB565: %.0f us", rgbLoad.median);
+    displayText(buf, 10, 80, TFT_WHITE);
+
+    displayText("Background to screen (median):", 10, 130, TFT_CYAN, 1);
+    sprintf(buf, "Buffered: 1st px %.0f us, %.0f us", bufFirstStats.median, bufTotalStats.median);
+    displayText(buf, 10, 145, bufOk ? TFT_WHITE : TFT_RED, 1);
+    sprintf(buf, "  RAM %u bytes", (unsigned)(BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2));
+    displayText(buf, 10, 160, TFT_WHITE, 1);
+    sprintf(buf, "Streamed: 1st px %.0f us, %.0f us", streamFirstStats.median, streamTotalStats.median);
+    displayText(buf, 10, 175, streamOk ? TFT_GREEN : TFT_RED, 1);
+    sprintf(buf, "  RAM %u bytes", (unsigned)stream.peakBytes);
+    displayText(buf, 10, 190, TFT_GREEN, 1);
+
+    addResult("B1_BG_Buf_First", bufFirstStats, "us");
+    addResult("B1_BG_Buf_Total", bufTotalStats, "us");
+    addResult("B1_BG_Stream_First", streamFirstStats, "us");
+    addResult("B1_BG_Stream_Total", streamTotalStats, "us");
+    addResult("B1_BG_Stream_RAM", stream.peakBytes, "bytes");
+
+    Serial.print("Background buffered: first pixel ");
+    Serial.print(bufFirstStats.median);
+    Serial.print(" us, total ");
+    Serial.print(bufTotalStats.median);
     Serial.println(" us");
+    Serial.print("Background streamed: first pixel ");
+    Serial.print(streamFirstStats.median);
+    Serial.print(" us, total ");
+    Serial.print(streamTotalStats.median);
+    Serial.print(" us, ");
+    Serial.print(stream.peakBytes);
+    Serial.println(" bytes RAM");
 
     waitForTouch();
 }
@@ -547,31 +728,38 @@ void testB2_RenderingSpeed()
     clearScreen();
     displayText("B2: Rendering Speed", 10, 10, TFT_CYAN);
 
-    // Load sprite once
-    loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
-
-    // Test rendering speed (10 iterations)
-    tft.setSwapBytes(true);
-    unsigned long start = micros();
-    for (int i = 0; i < 10; i++)
+    // Sprite comes from the asset cache (loaded once, shared with C1-C3)
+    uint16_t *fish = assets.pin(BLUEGILL_RGB565, BLUEGILL_BYTES);
+    if (!fish)
     {
-        tft.pushImage(100, 50, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bluegillBuffer);
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
     }
-    unsigned long renderTime = (micros() - start) / 10;
+
+    // Test rendering speed
+    tft.setSwapBytes(true);
+    BenchStats render = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                 { tft.pushImage(100, 50, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, fish); });
 
     char buf[50];
-    sprintf(buf, "Avg render: %lu us", renderTime);
+    sprintf(buf, "Median render: %.0f us", render.median);
     displayText(buf, 10, 50, TFT_WHITE);
+    sprintf(buf, "p95 %.0f us, p99 %.0f us", render.p95, render.p99);
+    displayText(buf, 10, 80, TFT_WHITE, 1);
 
-    sprintf(buf, "~%.1f FPS max", 1000000.0 / renderTime);
-    displayText(buf, 10, 80, TFT_YELLOW);
+    sprintf(buf, "~%.1f FPS max", 1000000.0 / render.median);
+    displayText(buf, 10, 100, TFT_YELLOW);
 
-    addResult("B2_Render_Time", renderTime, "us");
+    addResult("B2_Render_Time", render, "us");
 
-    Serial.print("Render Time: ");
-    Serial.print(renderTime);
+    Serial.print("Render Time: median ");
+    Serial.print(render.median);
+    Serial.print(" us, p99 ");
+    Serial.print(render.p99);
     Serial.println(" us");
 
+    assets.unpin(BLUEGILL_RGB565);
     waitForTouch();
 }
 
@@ -586,12 +774,9 @@ void testB3_MemoryUsage()
     sprintf(buf, "Free: %lu bytes", memBefore);
     displayText(buf, 10, 50, TFT_WHITE);
 
-    // Load background ( large sprite)
-    if (backgroundBuffer == nullptr)
-    {
-        backgroundBuffer = (uint16_t *)malloc(BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2);
-    }
-    loadRGB565FromSD("/sprite_tests/background_240x240.rgb565", backgroundBuffer, BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2);
+    // Load background ( large sprite) into the asset cache, where it stays
+    // for the B and C tests that draw it
+    assets.get(BACKGROUND_RGB565, BACKGROUND_BYTES);
 
     uint32_t memAfter = ESP.getFreeHeap();
     uint32_t used = memBefore - memAfter;
@@ -611,195 +796,2284 @@ void testB3_MemoryUsage()
     waitForTouch();
 }
 
-// ============================================================================
-// PART C: PERFORMANCE STRESS TESTS
-// ============================================================================
+// Counts pixels in the w x h area at (x, y) that differ from expected
+int countWrongPixels(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *expected, uint16_t *scratch)
+{
+    // readRect returns colours byte-swapped relative to pushImage input
+    tft.readRect(x, y, w, h, scratch);
+    int wrong = 0;
+    for (int32_t i = 0; i < w * h; i++)
+    {
+        uint16_t c = (scratch[i] >> 8) | (scratch[i] << 8);
+        if (c != expected[i])
+            wrong++;
+    }
+    return wrong;
+}
 
-void testC1_SpriteFPS()
+void testB4_TransparentBlit()
 {
     clearScreen();
-    displayText("C1: FPS Stress Test", 10, 10, TFT_CYAN);
+    displayText("B4: Transparent Blit", 10, 10, TFT_CYAN);
 
-    // Load bluegill sprite
+    const int32_t sx = 96, sy = 120;
+    const uint16_t bgColor = TFT_NAVY;
+
+    RLESprite rleFish;
+    if (!loadRLESpriteFromSD("/sprite_tests/fish_bluegill_32x32.rle565", rleFish))
+    {
+        displayText("No .rle565 sprite!", 10, 50, TFT_RED);
+        Serial.println("B4 skipped: run tools/png_to_rle565.py on the fish PNG");
+        waitForTouch();
+        return;
+    }
     loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
 
-    int spriteCounts[] = {5, 10, 15, 20, 25};
+    // The alpha mask from the RLE file is the reference for both methods
+    uint16_t *expected = (uint16_t *)malloc(BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+    uint16_t *readback = (uint16_t *)malloc(BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+    if (!expected || !readback)
+    {
+        displayText("MALLOC FAILED!", 10, 50, TFT_RED);
+        free(expected);
+        free(readback);
+        freeRLESprite(rleFish);
+        waitForTouch();
+        return;
+    }
+    expandRLESprite(rleFish, expected, bgColor);
+
     tft.setSwapBytes(true);
 
-    for (int countIdx = 0; countIdx < 5; countIdx++)
+    // Colour key: pushImage skipping TFT_BLACK
+    tft.fillRect(sx, sy, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bgColor);
+    BenchStats key = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                              { tft.pushImage(sx, sy, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bluegillBuffer, TFT_BLACK); });
+    unsigned long keyTime = key.median;
+    int keyWrong = countWrongPixels(sx, sy, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, expected, readback);
+
+    // RLE: opaque runs only
+    tft.fillRect(sx, sy, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bgColor);
+    BenchStats rle = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                              { drawRLESprite(tft, sx, sy, rleFish); });
+    unsigned long rleTime = rle.median;
+    int rleWrong = countWrongPixels(sx, sy, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, expected, readback);
+
+    char buf[50];
+    sprintf(buf, "Key: %lu us, %d bad px", keyTime, keyWrong);
+    displayText(buf, 10, 50, keyWrong ? TFT_RED : TFT_GREEN);
+    sprintf(buf, "RLE: %lu us, %d bad px", rleTime, rleWrong);
+    displayText(buf, 10, 80, rleWrong ? TFT_RED : TFT_GREEN);
+    sprintf(buf, "%lu opaque px, %lu runs", (unsigned long)rleFish.opaquePixels, (unsigned long)rleFish.runs);
+    displayText(buf, 10, 110, TFT_WHITE, 1);
+
+    addResult("B4_Key_Time", key, "us");
+    addResult("B4_Key_Wrong", keyWrong, "px");
+    addResult("B4_RLE_Time", rle, "us");
+    addResult("B4_RLE_Wrong", rleWrong, "px");
+
+    Serial.print("Colour key: ");
+    Serial.print(keyTime);
+    Serial.print(" us/sprite, ");
+    Serial.print(keyWrong);
+    Serial.println(" wrong pixels");
+    Serial.print("RLE runs: ");
+    Serial.print(rleTime);
+    Serial.print(" us/sprite, ");
+    Serial.print(rleWrong);
+    Serial.println(" wrong pixels");
+
+    free(expected);
+    free(readback);
+    freeRLESprite(rleFish);
+
+    waitForTouch();
+}
+
+void testB5_IndexedFormat()
+{
+    clearScreen();
+    displayText("B5: 8-bit Indexed", 10, 10, TFT_CYAN);
+
+    struct IndexedCase
     {
-        int numSprites = spriteCounts[countIdx];
+        const char *label;
+        const char *rawPath;
+        const char *idxPath;
+        int16_t w, h;
+        uint16_t *rawBuffer;
+    };
+
+    // The raw background is re-read into the cached copy for timing
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+
+    IndexedCase cases[] = {
+        {"BG", "/sprite_tests/background_240x240.rgb565", "/sprite_tests/background_240x240.idx8",
+         BACKGROUND_WIDTH, BACKGROUND_HEIGHT, background},
+        {"Fish", "/sprite_tests/fish_bluegill_32x32.rgb565", "/sprite_tests/fish_bluegill_32x32.idx8",
+         BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bluegillBuffer},
+    };
+
+    static uint16_t lineBuffer[SCREEN_WIDTH];
+    tft.setSwapBytes(true);
 
-        // Initialize sprite positions
-        for (int i = 0; i < numSprites; i++)
+    int y = 40;
+    for (int c = 0; c < 2; c++)
+    {
+        IndexedCase &tc = cases[c];
+        size_t rawBytes = (size_t)tc.w * tc.h * 2;
+
+        // Raw RGB565: load into the existing buffer, then full pushImage
+        bool rawOk = tc.rawBuffer != nullptr;
+        BenchStats rawLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                      { rawOk = rawOk && loadRGB565FromSD(tc.rawPath, tc.rawBuffer, rawBytes); });
+
+        BenchStats rawDraw = benchSingle(0);
+        if (rawOk)
         {
-            sprites[i].x = random(0, SCREEN_WIDTH - BLUEGILL_WIDTH);
-            sprites[i].y = random(0, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
-            sprites[i].dx = random(1, 4);
-            sprites[i].dy = random(1, 4);
-            sprites[i].active = true;
+            rawDraw = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                               { tft.pushImage(0, 0, tc.w, tc.h, tc.rawBuffer); });
         }
 
-        // Run for 3 seconds
-        unsigned long start = millis();
-        int frames = 0;
+        // Indexed: heap measured around the first load, drawn with line
+        // expansion; the timed loads each free their image again
+        IndexedImage image;
+        uint32_t heapBefore = ESP.getFreeHeap();
+        bool idxOk = loadIndexedFromSD(tc.idxPath, image);
+        uint32_t idxHeap = heapBefore - ESP.getFreeHeap();
 
-        while (millis() - start < 3000)
+        BenchStats idxLoad = benchSingle(0);
+        BenchStats idxDraw = benchSingle(0);
+        if (idxOk)
         {
-            tft.fillScreen(TFT_BLACK);
+            idxDraw = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                               { pushIndexedImage(tft, 0, 0, image, lineBuffer); });
+            freeIndexed(image);
+            idxLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                               {
+                                   IndexedImage timed;
+                                   if (loadIndexedFromSD(tc.idxPath, timed))
+                                       freeIndexed(timed);
+                                   else
+                                       idxOk = false;
+                               });
+        }
 
-            // Move and draw sprites
-            for (int i = 0; i < numSprites; i++)
-            {
-                sprites[i].x += sprites[i].dx;
-                sprites[i].y += sprites[i].dy;
+        clearScreen();
+        displayText("B5: 8-bit Indexed", 10, 10, TFT_CYAN);
+        char buf[60];
+        sprintf(buf, "%s raw: %uB ld %.0f dr %.0f us", tc.label, (unsigned)rawBytes, rawLoad.median, rawDraw.median);
+        displayText(buf, 10, y, rawOk ? TFT_WHITE : TFT_RED, 1);
+        sprintf(buf, "%s idx8: %luB ld %.0f dr %.0f us", tc.label, (unsigned long)idxHeap, idxLoad.median, idxDraw.median);
+        displayText(buf, 10, y + 15, idxOk ? TFT_GREEN : TFT_RED, 1);
+        y += 40;
 
-                // Bounce at edges
-                if (sprites[i].x <= 0 || sprites[i].x >= SCREEN_WIDTH - BLUEGILL_WIDTH)
-                {
-                    sprites[i].dx = -sprites[i].dx;
-                }
-                if (sprites[i].y <= 0 || sprites[i].y >= SCREEN_HEIGHT - BLUEGILL_HEIGHT)
-                {
-                    sprites[i].dy = -sprites[i].dy;
-                }
+        char resultName[20];
+        sprintf(resultName, "B5_%s_Raw_Load", tc.label);
+        addResult(resultName, rawLoad, "us");
+        sprintf(resultName, "B5_%s_Idx_Load", tc.label);
+        addResult(resultName, idxLoad, "us");
+        sprintf(resultName, "B5_%s_Raw_Draw", tc.label);
+        addResult(resultName, rawDraw, "us");
+        sprintf(resultName, "B5_%s_Idx_Draw", tc.label);
+        addResult(resultName, idxDraw, "us");
+        sprintf(resultName, "B5_%s_Idx_Heap", tc.label);
+        addResult(resultName, idxHeap, "bytes");
+
+        Serial.print(tc.label);
+        Serial.print(" raw RGB565: ");
+        Serial.print(rawBytes);
+        Serial.print(" bytes, load ");
+        Serial.print(rawLoad.median);
+        Serial.print(" us, draw ");
+        Serial.print(rawDraw.median);
+        Serial.println(" us");
+        Serial.print(tc.label);
+        Serial.print(" indexed: ");
+        Serial.print(idxHeap);
+        Serial.print(" bytes heap, load ");
+        Serial.print(idxLoad.median);
+        Serial.print(" us, draw ");
+        Serial.print(idxDraw.median);
+        Serial.println(" us");
+    }
 
-                tft.pushImage(sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bluegillBuffer);
-            }
+    assets.unpin(BACKGROUND_RGB565);
+    waitForTouch();
+}
 
-            frames++;
-        }
+void testB6_AtlasLoading()
+{
+    clearScreen();
+    displayText("B6: Atlas vs Files", 10, 10, TFT_CYAN);
 
-        float fps = frames / 3.0;
+    // Timed loads of the background go into its cached copy
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+    if (!background)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
 
-        // Display result
-        clearScreen();
-        displayText("C1: FPS Test", 10, 10, TFT_CYAN);
-        char buf[50];
-        sprintf(buf, "%d sprites:", numSprites);
-        displayText(buf, 10, 50, TFT_WHITE);
-        sprintf(buf, "%.1f FPS", fps);
-        displayText(buf, 10, 80, TFT_YELLOW, 4);
+    bool filesOk = true;
+    bool atlasOk = true;
+
+    // Separate files: one SD.open per asset
+    BenchStats filesTime = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                    {
+                                        filesOk &= loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+                                        filesOk &= loadRGB565FromSD("/sprite_tests/enemy_clanker_32x32.rgb565", clankerBuffer, CLANKER_WIDTH * CLANKER_HEIGHT * 2);
+                                        filesOk &= loadRGB565FromSD("/sprite_tests/background_240x240.rgb565", background, BACKGROUND_BYTES);
+                                    });
+
+    // Atlas: one open and table read, then a seek per asset
+    static SpriteAtlas atlas;
+    BenchStats atlasTime = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                    {
+                                        atlasOk &= atlas.open("/sprite_tests/sprites.atlas");
+                                        atlasOk &= atlas.loadRGB565("fish_bluegill_32x32", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+                                        atlasOk &= atlas.loadRGB565("enemy_clanker_32x32", clankerBuffer, CLANKER_WIDTH * CLANKER_HEIGHT * 2);
+                                        atlasOk &= atlas.loadRGB565("background_240x240", background, BACKGROUND_BYTES);
+                                        atlas.close();
+                                    });
+
+    // Small sprites alone, where the open cost dominates
+    BenchStats filesSmall = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, []()
+                                     {
+                                         loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+                                         loadRGB565FromSD("/sprite_tests/enemy_clanker_32x32.rgb565", clankerBuffer, CLANKER_WIDTH * CLANKER_HEIGHT * 2);
+                                     });
+
+    atlas.open("/sprite_tests/sprites.atlas");
+    BenchStats atlasSmall = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, []()
+                                     {
+                                         atlas.loadRGB565("fish_bluegill_32x32", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+                                         atlas.loadRGB565("enemy_clanker_32x32", clankerBuffer, CLANKER_WIDTH * CLANKER_HEIGHT * 2);
+                                     });
+    atlas.close();
 
-        char resultName[20];
-        sprintf(resultName, "C1_FPS_%d", numSprites);
-        addResult(resultName, fps, "FPS");
+    char buf[50];
+    sprintf(buf, "Files: %.0f us", filesTime.median);
+    displayText(buf, 10, 50, filesOk ? TFT_WHITE : TFT_RED);
+    sprintf(buf, "Atlas: %.0f us", atlasTime.median);
+    displayText(buf, 10, 80, atlasOk ? TFT_WHITE : TFT_RED);
+    displayText("Fish + clanker + background", 10, 110, TFT_WHITE, 1);
+    sprintf(buf, "Sprites only: %.0f vs %.0f us", filesSmall.median, atlasSmall.median);
+    displayText(buf, 10, 130, TFT_YELLOW, 1);
+
+    addResult("B6_Files_Load", filesTime, "us");
+    addResult("B6_Atlas_Load", atlasTime, "us");
+    addResult("B6_Files_Sprites", filesSmall, "us");
+    addResult("B6_Atlas_Sprites", atlasSmall, "us");
+
+    Serial.print("Separate files: median ");
+    Serial.print(filesTime.median);
+    Serial.print(" us, atlas: ");
+    Serial.print(atlasTime.median);
+    Serial.println(" us (bluegill + clanker + background)");
+    Serial.print("Sprites only (atlas already open): ");
+    Serial.print(filesSmall.median);
+    Serial.print(" us vs ");
+    Serial.print(atlasSmall.median);
+    Serial.println(" us");
 
-        Serial.print(numSprites);
-        Serial.print(" sprites: ");
-        Serial.print(fps);
-        Serial.println(" FPS");
+    assets.unpin(BACKGROUND_RGB565);
+    waitForTouch();
+}
 
-        delay(1500);
+void testB7_SpiClockSweep()
+{
+    clearScreen();
+    displayText("B7: SPI Clock Sweep", 10, 10, TFT_CYAN);
+
+    int32_t w = tft.width();
+    uint16_t *buffer = (uint16_t *)malloc(w * SWEEP_BAND_HEIGHT * 2);
+    if (!buffer)
+    {
+        displayText("MALLOC FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    // Stops at the first clock whose pattern doesn't read back intact
+    SpiSweepStep steps[SWEEP_STEPS];
+    int run = spiSweep(tft, sweepFreqs, SWEEP_STEPS, 0, tft.height() - SWEEP_BAND_HEIGHT, w, SWEEP_BAND_HEIGHT,
+                       buffer, steps);
+    free(buffer);
+
+    clearScreen();
+    displayText("B7: SPI Clock Sweep", 10, 10, TFT_CYAN);
+
+    char buf[50];
+    char resultName[24];
+    uint32_t maxStable = 0;
+    for (int i = 0; i < run; i++)
+    {
+        const SpiSweepStep &step = steps[i];
+        sprintf(buf, "%2lu MHz %5.2f MB/s %s", (unsigned long)(step.hz / 1000000), step.fillMBps,
+                step.passed ? "PASS" : "FAIL");
+        displayText(buf, 10, 50 + i * 25, step.passed ? TFT_GREEN : TFT_RED);
+
+        sprintf(resultName, "B7_Fill_%luMHz", (unsigned long)(step.hz / 1000000));
+        addResult(resultName, step.fillMBps, "MB/s");
+        if (step.passed)
+            maxStable = step.hz;
+
+        Serial.print(step.hz / 1000000);
+        Serial.print(" MHz: ");
+        Serial.print(step.fillMBps);
+        Serial.print(" MB/s fill, ");
+        if (step.passed)
+        {
+            Serial.println("read-back OK");
+        }
+        else
+        {
+            Serial.print("read-back FAILED, ");
+            Serial.print(step.badPixels);
+            Serial.println(" bad pixels");
+        }
     }
+    addResult("B7_Max_Stable", maxStable / 1000000.0f, "MHz");
+
+    waitForTouch();
 }
 
-void testC2_BackgroundPlusSprites()
+// Random 12.4 fixed-point velocity of 1-4 pixels per frame in either
+// direction, with a subpixel part
+int16_t randomEntitySpeed()
+{
+    int16_t speed = random(ENTITY_ONE, 4 * ENTITY_ONE);
+    return random(0, 2) ? speed : -speed;
+}
+
+// 12.4 fixed-point velocity rounded to the nearest whole pixel
+int16_t wholePixels(int16_t v)
+{
+    return v < 0 ? -((-v + ENTITY_ONE / 2) >> ENTITY_FRAC_BITS) : (v + ENTITY_ONE / 2) >> ENTITY_FRAC_BITS;
+}
+
+void testB8_EntityUpdate()
 {
     clearScreen();
-    displayText("C2: BG + Sprites Test", 10, 10, TFT_CYAN);
+    displayText("B8: Entity Update", 10, 10, TFT_CYAN);
 
-    // Load assets
-    loadRGB565FromSD("/sprite_tests/background_240x240.rgb565", backgroundBuffer, BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2);
-    loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
+    int16_t maxX = tft.width() - 1;
+    int16_t maxY = tft.height() - 1;
+    uint32_t most = entityCounts[ENTITY_STEPS - 1];
 
-    // Initialize 10 sprites
-    for (int i = 0; i < 10; i++)
+    // The SoA store against the same motion on the Sprite structs the
+    // stress tests use (skipped if both don't fit)
+    EntityStore store;
+    if (!store.begin(most))
     {
-        sprites[i].x = random(0, BACKGROUND_WIDTH - BLUEGILL_WIDTH);
-        sprites[i].y = random(0, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT);
-        sprites[i].dx = random(1, 3);
-        sprites[i].dy = random(1, 3);
-        sprites[i].active = true;
+        displayText("MALLOC FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
     }
+    Sprite *structs = (Sprite *)malloc(most * sizeof(Sprite));
+    if (!structs)
+        Serial.println("B8: no room for the Sprite array, SoA only");
 
-    tft.setSwapBytes(true);
-    unsigned long start = millis();
-    int frames = 0;
+    struct EntitySpawn
+    {
+        int16_t x, y, vx, vy;
+        uint16_t life;
+    };
+    static EntitySpawn spawnTable[ENTITY_SPAWN_TABLE];
 
-    while (millis() - start < 5000)
+    char buf[50];
+    char resultName[24];
+    for (int step = 0; step < ENTITY_STEPS; step++)
     {
-        // Draw background
-        tft.pushImage(0, 0, BACKGROUND_WIDTH, BACKGROUND_HEIGHT, backgroundBuffer);
+        uint32_t n = entityCounts[step];
+        uint32_t passes = ENTITY_SAMPLE_UPDATES / n;
 
-        // Move and draw sprites
-        for (int i = 0; i < 10; i++)
+        store.clear();
+        for (uint32_t i = 0; i < n; i++)
         {
-            sprites[i].x += sprites[i].dx;
-            sprites[i].y += sprites[i].dy;
+            store.spawn(random(0, maxX) << ENTITY_FRAC_BITS, random(0, maxY) << ENTITY_FRAC_BITS,
+                        randomEntitySpeed(), randomEntitySpeed());
+        }
 
-            if (sprites[i].x <= 0 || sprites[i].x >= BACKGROUND_WIDTH - BLUEGILL_WIDTH)
-            {
-                sprites[i].dx = -sprites[i].dx;
-            }
-            if (sprites[i].y <= 0 || sprites[i].y >= BACKGROUND_HEIGHT - BLUEGILL_HEIGHT)
+        // The structs start where the store does, with its velocities
+        // rounded to whole pixels (the Sprite fields have no fraction)
+        if (structs)
+        {
+            for (uint32_t i = 0; i < n; i++)
             {
-                sprites[i].dy = -sprites[i].dy;
+                structs[i].x = store.pixelX(i);
+                structs[i].y = store.pixelY(i);
+                structs[i].dx = wholePixels(store.vx[i]);
+                structs[i].dy = wholePixels(store.vy[i]);
+                structs[i].active = true;
             }
-
-            tft.pushImage(sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, bluegillBuffer);
         }
 
-        frames++;
-    }
-
-    float fps = frames / 5.0;
+        BenchStats soa = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                  {
+                                      for (uint32_t p = 0; p < passes; p++)
+                                          store.update(maxX, maxY);
+                                  });
 
-    // Display result
-    clearScreen();
-    displayText("C2: BG + Sprites", 10, 10, TFT_CYAN);
-    char buf[50];
-    displayText("Background + 10 fish", 10, 50, TFT_WHITE);
-    sprintf(buf, "%.1f FPS", fps);
-    displayText(buf, 10, 80, TFT_YELLOW, 4);
+        // Steady state for short-lived bullets: update, compact, refill. The
+        // refill reads the spawn table, so random() stays out of the timing.
+        for (int i = 0; i < ENTITY_SPAWN_TABLE; i++)
+        {
+            spawnTable[i].x = random(0, maxX) << ENTITY_FRAC_BITS;
+            spawnTable[i].y = random(0, maxY) << ENTITY_FRAC_BITS;
+            spawnTable[i].vx = randomEntitySpeed();
+            spawnTable[i].vy = randomEntitySpeed();
+            spawnTable[i].life = random(ENTITY_LIFE_MIN, ENTITY_LIFE_MAX);
+        }
+        store.clear();
+        uint32_t nextSpawn = 0;
+        BenchStats churn = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                    {
+                                        for (uint32_t p = 0; p < passes; p++)
+                                        {
+                                            store.update(maxX, maxY);
+                                            store.compact();
+                                            while (store.size() < n)
+                                            {
+                                                const EntitySpawn &e = spawnTable[nextSpawn++ % ENTITY_SPAWN_TABLE];
+                                                store.spawn(e.x, e.y, e.vx, e.vy, e.life);
+                                            }
+                                        }
+                                    });
+
+        BenchStats aos = {};
+        if (structs)
+        {
+            aos = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                           {
+                               for (uint32_t p = 0; p < passes; p++)
+                                   for (uint32_t i = 0; i < n; i++)
+                                       moveSprite(structs[i], maxX, maxY);
+                           });
+        }
 
-    addResult("C2_BG_Sprites_FPS", fps, "FPS");
+        // Entity updates per second from the median sample time
+        float updates = (float)n * passes;
+        float soaRate = soa.median > 0 ? updates / soa.median : 0;
+        float churnRate = churn.median > 0 ? updates / churn.median : 0;
+        float aosRate = aos.median > 0 ? updates / aos.median : 0;
+
+        sprintf(buf, "%lu: SoA %.2f M/s", (unsigned long)n, soaRate);
+        displayText(buf, 10, 50 + step * 60, TFT_GREEN);
+        sprintf(buf, "churn %.2f  Sprite %.2f M/s", churnRate, aosRate);
+        displayText(buf, 10, 75 + step * 60, TFT_WHITE, 1);
+
+        sprintf(resultName, "B8_SoA_%lu", (unsigned long)n);
+        addResult(resultName, soaRate, "Mupd/s");
+        sprintf(resultName, "B8_Churn_%lu", (unsigned long)n);
+        addResult(resultName, churnRate, "Mupd/s");
+        if (structs)
+        {
+            sprintf(resultName, "B8_Struct_%lu", (unsigned long)n);
+            addResult(resultName, aosRate, "Mupd/s");
+        }
 
-    Serial.print("Background + 10 sprites: ");
-    Serial.print(fps);
-    Serial.println(" FPS");
+        Serial.printf("%lu entities: SoA %.1f us/pass (%.2f M/s), with churn %.1f us, Sprite structs %.1f us\n",
+                      (unsigned long)n, soa.median / passes, soaRate, churn.median / passes, aos.median / passes);
+    }
 
+    free(structs);
+    store.end();
     waitForTouch();
 }
 
-// ============================================================================
-// RESULTS DISPLAY
-// ============================================================================
+// Bytes on the card, 0 if the file is missing
+size_t sdFileSize(const char *filepath)
+{
+    File file = SD.open(filepath);
+    if (!file)
+        return 0;
+    size_t size = file.size();
+    file.close();
+    return size;
+}
 
-void displayResults()
+// FNV-1a over a decoded image, so a decode can be checked against the raw
+// load in the same buffer
+uint32_t imageHash(const uint16_t *pixels, size_t count)
+{
+    const uint8_t *bytes = (const uint8_t *)pixels;
+    uint32_t hash = 0x811C9DC5;
+    for (size_t i = 0; i < count * 2; i++)
+        hash = (hash ^ bytes[i]) * 0x01000193;
+    return hash;
+}
+
+void testB9_CompressedAssets()
 {
     clearScreen();
-    displayText("=== TEST RESULTS ===", 10, 5, TFT_CYAN, 2);
+    displayText("B9: Compressed Assets", 10, 10, TFT_CYAN);
 
-    int y = 30;
-    for (int i = 0; i < resultCount && y < 300; i++)
+    struct CompressedCase
     {
-        char buf[80];
-        sprintf(buf, "%s: %.1f %s", results[i].name, results[i].value, results[i].unit);
-        displayText(buf, 10, y, TFT_WHITE, 1);
-        y += 15;
-    }
+        const char *label;
+        const char *rawPath;
+        const char *pngPath;
+        const char *lzPath;
+        const char *lziPath;
+        int16_t w, h;
+    };
+
+    CompressedCase cases[] = {
+        {"Fish", BLUEGILL_RGB565, "/sprite_tests/fish_bluegill_32x32.png", BLUEGILL_LZ565, BLUEGILL_LZI8,
+         BLUEGILL_WIDTH, BLUEGILL_HEIGHT},
+        {"BG", BACKGROUND_RGB565, "/sprite_tests/background_240x240.png", BACKGROUND_LZ565, BACKGROUND_LZI8,
+         BACKGROUND_WIDTH, BACKGROUND_HEIGHT},
+    };
 
-    displayText("See Serial for full output", 10, 305, TFT_YELLOW, 1);
+    char buf[60];
+    char resultName[24];
+    int y = 40;
+    for (int c = 0; c < 2; c++)
+    {
+        CompressedCase &tc = cases[c];
+        size_t pixels = (size_t)tc.w * tc.h;
+        uint16_t *buffer = (uint16_t *)malloc(pixels * 2);
+        if (!buffer)
+        {
+            displayText("MALLOC FAILED!", 10, y, TFT_RED, 1);
+            y += 45;
+            continue;
+        }
 
-    // Print to serial
-    Serial.println("\n===== TEST RESULTS =====");
-    for (int i = 0; i < resultCount; i++)
+        // Each load fills the same buffer; the LZ RGB565 decode must match
+        // the raw file exactly
+        bool rawOk = loadRGB565FromSD(tc.rawPath, buffer, pixels * 2);
+        uint32_t rawHash = imageHash(buffer, pixels);
+        bool lzOk = loadLzFromSD(tc.lzPath, buffer, tc.w, tc.h);
+        bool lzExact = lzOk && rawOk && imageHash(buffer, pixels) == rawHash;
+
+        bool pngOk = true, lziOk = true;
+        BenchStats rawLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                      { rawOk &= loadRGB565FromSD(tc.rawPath, buffer, pixels * 2); });
+        BenchStats pngLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                      { pngOk &= loadPNGFromSD(tc.pngPath, buffer, tc.w, tc.h); });
+        BenchStats lzLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                     { lzOk &= loadLzFromSD(tc.lzPath, buffer, tc.w, tc.h); });
+        BenchStats lziLoad = benchRun(LOAD_WARMUP, LOAD_ITERATIONS, [&]()
+                                      { lziOk &= loadLzFromSD(tc.lziPath, buffer, tc.w, tc.h); });
+        free(buffer);
+
+        // Decoder RAM is the window plus the input buffer, whatever the size
+        LzReader probe;
+        size_t lzRam = probe.open(tc.lzPath) ? probe.getWorkingBytes() : 0;
+        probe.close();
+        size_t lziRam = probe.open(tc.lziPath) ? probe.getWorkingBytes() : 0;
+        probe.close();
+
+        size_t rawSize = pixels * 2;
+        size_t pngSize = sdFileSize(tc.pngPath);
+        size_t lzSize = sdFileSize(tc.lzPath);
+        size_t lziSize = sdFileSize(tc.lziPath);
+        float lzRatio = lzSize ? (float)rawSize / lzSize : 0;
+        float lziRatio = lziSize ? (float)rawSize / lziSize : 0;
+
+        sprintf(buf, "%s raw %uB %.0f us, PNG %uB %.0f us", tc.label, (unsigned)rawSize, rawLoad.median,
+                (unsigned)pngSize, pngLoad.median);
+        displayText(buf, 10, y, rawOk && pngOk ? TFT_WHITE : TFT_RED, 1);
+        sprintf(buf, "  lz565 %uB %.0f us (%.1fx) %uB RAM", (unsigned)lzSize, lzLoad.median, lzRatio, (unsigned)lzRam);
+        displayText(buf, 10, y + 15, lzExact && lzOk ? TFT_GREEN : TFT_RED, 1);
+        sprintf(buf, "  lzi8 %uB %.0f us (%.1fx) %uB RAM", (unsigned)lziSize, lziLoad.median, lziRatio, (unsigned)lziRam);
+        displayText(buf, 10, y + 30, lziOk ? TFT_GREEN : TFT_RED, 1);
+        y += 45;
+
+        sprintf(resultName, "B9_%s_Raw_Load", tc.label);
+        addResult(resultName, rawLoad, "us");
+        sprintf(resultName, "B9_%s_PNG_Load", tc.label);
+        addResult(resultName, pngLoad, "us");
+        sprintf(resultName, "B9_%s_LZ_Load", tc.label);
+        addResult(resultName, lzLoad, "us");
+        sprintf(resultName, "B9_%s_LZI_Load", tc.label);
+        addResult(resultName, lziLoad, "us");
+        sprintf(resultName, "B9_%s_PNG_Bytes", tc.label);
+        addResult(resultName, pngSize, "bytes");
+        sprintf(resultName, "B9_%s_LZ_Bytes", tc.label);
+        addResult(resultName, lzSize, "bytes");
+        sprintf(resultName, "B9_%s_LZI_Bytes", tc.label);
+        addResult(resultName, lziSize, "bytes");
+        sprintf(resultName, "B9_%s_LZ_RAM", tc.label);
+        addResult(resultName, lzRam, "bytes");
+
+        Serial.printf("%s: raw %u bytes %.0f us, PNG %u bytes %.0f us (medians)\n", tc.label, (unsigned)rawSize,
+                      rawLoad.median, (unsigned)pngSize, pngLoad.median);
+        Serial.printf("  lz565 %u bytes (%.2fx) %.0f us, %u bytes RAM%s\n", (unsigned)lzSize, lzRatio, lzLoad.median,
+                      (unsigned)lzRam, lzExact ? "" : ", DOES NOT MATCH RAW");
+        Serial.printf("  lzi8 %u bytes (%.2fx) %.0f us, %u bytes RAM%s\n", (unsigned)lziSize, lziRatio, lziLoad.median,
+                      (unsigned)lziRam, lziOk ? "" : ", FAILED");
+    }
+
+    // Background straight to the panel: raw file vs LZ, both streamed in
+    // chunks with DMA
+    StreamStats rawStream = {0, 0, 0};
+    StreamStats lzStream = {0, 0, 0};
+    BenchSampler rawStreamTimes(LOAD_ITERATIONS), lzStreamTimes(LOAD_ITERATIONS);
+    bool rawStreamOk = true, lzStreamOk = true;
+    tft.setSwapBytes(true);
+    tft.initDMA();
+    for (int i = 0; i < LOAD_ITERATIONS; i++)
     {
-        Serial.print(results[i].name);
-        Serial.print(": ");
-        Serial.print(results[i].value);
-        Serial.print(" ");
-        Serial.println(results[i].unit);
+        rawStreamOk &= streamRGB565FromSD(tft, BACKGROUND_RGB565, 0, 0, BACKGROUND_WIDTH, BACKGROUND_HEIGHT,
+                                          STREAM_CHUNK_ROWS, &rawStream);
+        rawStreamTimes.add(rawStream.totalUs);
+        lzStreamOk &= streamLzFromSD(tft, BACKGROUND_LZ565, 0, 0, STREAM_CHUNK_ROWS, &lzStream);
+        lzStreamTimes.add(lzStream.totalUs);
     }
-    Serial.println("========================\n");
-}
+    tft.deInitDMA();
+    BenchStats rawStreamStats = rawStreamTimes.stats();
+    BenchStats lzStreamStats = lzStreamTimes.stats();
 
-// ============================================================================
-// SETUP AND MAIN LOOP
-// ============================================================================
+    clearScreen();
+    displayText("B9: Compressed Assets", 10, 10, TFT_CYAN);
+    displayText("Background streamed to screen:", 10, 40, TFT_CYAN, 1);
+    sprintf(buf, "raw: 1st px %lu us, %.0f us, %uB RAM", rawStream.firstPixelUs, rawStreamStats.median,
+            (unsigned)rawStream.peakBytes);
+    displayText(buf, 10, 55, rawStreamOk ? TFT_WHITE : TFT_RED, 1);
+    sprintf(buf, "lz565: 1st px %lu us, %.0f us, %uB RAM", lzStream.firstPixelUs, lzStreamStats.median,
+            (unsigned)lzStream.peakBytes);
+    displayText(buf, 10, 70, lzStreamOk ? TFT_GREEN : TFT_RED, 1);
+
+    addResult("B9_BG_Stream_Raw", rawStreamStats, "us");
+    addResult("B9_BG_Stream_LZ", lzStreamStats, "us");
+    addResult("B9_BG_Stream_LZ_RAM", lzStream.peakBytes, "bytes");
+
+    Serial.printf("Background streamed: raw %.0f us (%u bytes RAM), lz565 %.0f us (%u bytes RAM)%s\n",
+                  rawStreamStats.median, (unsigned)rawStream.peakBytes, lzStreamStats.median,
+                  (unsigned)lzStream.peakBytes, lzStreamOk ? "" : ", FAILED");
 
-void setup()
+    waitForTouch();
+}
+
+void testB10_FlashAssets()
+{
+    clearScreen();
+    displayText("B10: Flash Assets", 10, 10, TFT_CYAN);
+
+    // The test pattern is embedded by tools/png_to_header.py from the same
+    // .rgb565 file the SD path loads
+    const FlashImage &image = test_pattern_32x32;
+    size_t bytes = (size_t)image.width * image.height * 2;
+    const int32_t sdX = 60, flashX = 140, drawY = 60;
+    uint16_t *readback = (uint16_t *)malloc(bytes);
+
+    // Startup to first draw: the SD sprite needs a buffer and a file read
+    // before it can be pushed, the flash one is there from reset
+    tft.setSwapBytes(true);
+    uint32_t heapBefore = ESP.getFreeHeap();
+    unsigned long start = micros();
+    uint16_t *sdCopy = (uint16_t *)malloc(bytes);
+    bool sdOk = sdCopy && loadRGB565FromSD("/sprite_tests/test_pattern_32x32.rgb565", sdCopy, bytes);
+    if (sdOk)
+        tft.pushImage(sdX, drawY, image.width, image.height, sdCopy);
+    unsigned long sdStartup = micros() - start;
+    uint32_t sdHeap = heapBefore - ESP.getFreeHeap();
+
+    heapBefore = ESP.getFreeHeap();
+    start = micros();
+    pushFlashImage(tft, flashX, drawY, image);
+    unsigned long flashStartup = micros() - start;
+    uint32_t flashHeap = heapBefore - ESP.getFreeHeap();
+
+    int wrong = sdOk && readback ? countWrongPixels(flashX, drawY, image.width, image.height, sdCopy, readback) : -1;
+
+    // Push speed: RAM copy, flash handed to pushPixels as is, and flash
+    // through TFT_eSPI's PROGMEM pushImage, which copies via a small buffer
+    BenchStats ramPush = {};
+    if (sdOk)
+        ramPush = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                           { tft.pushImage(sdX, drawY, image.width, image.height, sdCopy); });
+    BenchStats flashPush = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                    { pushFlashImage(tft, flashX, drawY, image); });
+    tft.setSwapBytes(false);
+    BenchStats copyPush = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                   { tft.pushImage(flashX, drawY, image.width, image.height, image.pixels); });
+    tft.setSwapBytes(true);
+
+    free(sdCopy);
+    free(readback);
+
+    char buf[60];
+    sprintf(buf, "SD:    1st draw %lu us, %lu B heap", sdStartup, (unsigned long)sdHeap);
+    displayText(buf, 10, 110, sdOk ? TFT_WHITE : TFT_RED, 1);
+    sprintf(buf, "Flash: 1st draw %lu us, %lu B heap", flashStartup, (unsigned long)flashHeap);
+    displayText(buf, 10, 125, TFT_GREEN, 1);
+    sprintf(buf, "Push: RAM %.0f, flash %.0f, copy %.0f us", ramPush.median, flashPush.median, copyPush.median);
+    displayText(buf, 10, 145, TFT_WHITE, 1);
+    sprintf(buf, "Flash vs SD: %d wrong pixels", wrong);
+    displayText(buf, 10, 165, wrong == 0 ? TFT_GREEN : TFT_RED, 1);
+
+    addResult("B10_SD_Startup", sdStartup, "us");
+    addResult("B10_Flash_Startup", flashStartup, "us");
+    addResult("B10_SD_Heap", sdHeap, "bytes");
+    addResult("B10_Flash_Heap", flashHeap, "bytes");
+    if (sdOk)
+        addResult("B10_RAM_Push", ramPush, "us");
+    addResult("B10_Flash_Push", flashPush, "us");
+    addResult("B10_Flash_Copy_Push", copyPush, "us");
+
+    Serial.printf("SD sprite: first draw %lu us, %lu bytes heap%s\n", sdStartup, (unsigned long)sdHeap,
+                  sdOk ? "" : " (LOAD FAILED)");
+    Serial.printf("Flash sprite: first draw %lu us, %lu bytes heap, %d wrong pixels\n", flashStartup,
+                  (unsigned long)flashHeap, wrong);
+    Serial.printf("Push %dx%d: RAM %.1f us, flash zero-copy %.1f us, flash via pushImage %.1f us\n",
+                  image.width, image.height, ramPush.median, flashPush.median, copyPush.median);
+
+    waitForTouch();
+}
+
+enum TransformKind
+{
+    TRANSFORM_PLAIN,
+    TRANSFORM_MIRROR,
+    TRANSFORM_SCALE_UP,
+    TRANSFORM_SCALE_DOWN,
+    TRANSFORM_ROTATE,
+    TRANSFORM_KINDS
+};
+const char *const transformNames[TRANSFORM_KINDS] = {"Plain", "Mirror", "Scale2x", "Scale05x", "Rotate"};
+
+// Draws the fish transformed about the centre of the TRANSFORM_AREA square
+// at (ax, ay) on the panel, or into area (a square buffer) when given
+void drawTransformed(int kind, const uint16_t *fish, int32_t ax, int32_t ay, uint16_t *area = nullptr)
+{
+    const int32_t c = TRANSFORM_AREA / 2;
+    const int16_t w = BLUEGILL_WIDTH, h = BLUEGILL_HEIGHT;
+    switch (kind)
+    {
+    case TRANSFORM_PLAIN:
+        if (area)
+        {
+            for (int32_t row = 0; row < h; row++)
+                memcpy(area + (c - h / 2 + row) * TRANSFORM_AREA + c - w / 2, fish + row * w, w * 2);
+        }
+        else
+        {
+            tft.pushImage(ax + c - w / 2, ay + c - h / 2, w, h, fish);
+        }
+        break;
+    case TRANSFORM_MIRROR:
+        if (area)
+            blitFlipped(area, TRANSFORM_AREA, TRANSFORM_AREA, c - w / 2, c - h / 2, fish, w, h);
+        else
+            pushImageFlipped(tft, ax + c - w / 2, ay + c - h / 2, w, h, fish);
+        break;
+    case TRANSFORM_SCALE_UP:
+        if (area)
+            blitScaled(area, TRANSFORM_AREA, TRANSFORM_AREA, c - w, c - h, fish, w, h, 2 * TRANSFORM_ONE);
+        else
+            pushImageScaled(tft, ax + c - w, ay + c - h, w, h, fish, 2 * TRANSFORM_ONE);
+        break;
+    case TRANSFORM_SCALE_DOWN:
+        if (area)
+            blitScaled(area, TRANSFORM_AREA, TRANSFORM_AREA, c - w / 4, c - h / 4, fish, w, h, TRANSFORM_ONE / 2);
+        else
+            pushImageScaled(tft, ax + c - w / 4, ay + c - h / 4, w, h, fish, TRANSFORM_ONE / 2);
+        break;
+    case TRANSFORM_ROTATE:
+        if (area)
+            blitRotated(area, TRANSFORM_AREA, TRANSFORM_AREA, c, c, fish, w, h, TRANSFORM_ANGLE);
+        else
+            pushImageRotated(tft, ax + c, ay + c, w, h, fish, TRANSFORM_ANGLE);
+        break;
+    }
+}
+
+void testB11_SpriteTransforms()
+{
+    clearScreen();
+    displayText("B11: Sprite Transforms", 10, 10, TFT_CYAN);
+
+    // Each transform is drawn on the panel and into a RAM square the same
+    // size; the panel readback must match the RAM copy, and the RAM mirror
+    // must match the fish read backwards
+    const int32_t ax = 210, ay = 70;
+    size_t areaBytes = (size_t)TRANSFORM_AREA * TRANSFORM_AREA * 2;
+    uint16_t *expected = (uint16_t *)malloc(areaBytes);
+    uint16_t *readback = (uint16_t *)malloc(areaBytes);
+    if (!expected || !readback ||
+        !loadRGB565FromSD("/sprite_tests/fish_bluegill_32x32.rgb565", bluegillBuffer, BLUEGILL_BYTES))
+    {
+        displayText("SETUP FAILED!", 10, 50, TFT_RED);
+        free(expected);
+        free(readback);
+        waitForTouch();
+        return;
+    }
+
+    tft.setSwapBytes(true);
+    char buf[60];
+    char resultName[32];
+    int totalWrong = 0;
+
+    for (int kind = 0; kind < TRANSFORM_KINDS; kind++)
+    {
+        tft.fillRect(ax, ay, TRANSFORM_AREA, TRANSFORM_AREA, TFT_BLACK);
+        drawTransformed(kind, bluegillBuffer, ax, ay);
+        memset(expected, 0, areaBytes);
+        drawTransformed(kind, bluegillBuffer, ax, ay, expected);
+        int wrong = countWrongPixels(ax, ay, TRANSFORM_AREA, TRANSFORM_AREA, expected, readback);
+
+        if (kind == TRANSFORM_MIRROR)
+        {
+            const int32_t left = TRANSFORM_AREA / 2 - BLUEGILL_WIDTH / 2, top = TRANSFORM_AREA / 2 - BLUEGILL_HEIGHT / 2;
+            for (int32_t row = 0; row < BLUEGILL_HEIGHT; row++)
+            {
+                for (int32_t col = 0; col < BLUEGILL_WIDTH; col++)
+                {
+                    if (expected[(top + row) * TRANSFORM_AREA + left + col] !=
+                        bluegillBuffer[row * BLUEGILL_WIDTH + BLUEGILL_WIDTH - 1 - col])
+                        wrong++;
+                }
+            }
+        }
+        totalWrong += wrong;
+
+        // Per sprite: pushed to the panel, and blitted into RAM
+        BenchStats push = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                   { drawTransformed(kind, bluegillBuffer, ax, ay); });
+        BenchStats blit = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                   {
+                                       for (int i = 0; i < TRANSFORM_BLITS_PER_SAMPLE; i++)
+                                           drawTransformed(kind, bluegillBuffer, ax, ay, expected);
+                                   });
+        float blitUs = blit.median / TRANSFORM_BLITS_PER_SAMPLE;
+
+        sprintf(buf, "%-8s push %6.0f  RAM %5.1f us", transformNames[kind], push.median, blitUs);
+        displayText(buf, 10, 50 + kind * 20, wrong == 0 ? TFT_WHITE : TFT_RED, 1);
+
+        sprintf(resultName, "B11_%s_Push", transformNames[kind]);
+        addResult(resultName, push, "us");
+        sprintf(resultName, "B11_%s_Blit", transformNames[kind]);
+        addResult(resultName, blitUs, "us");
+
+        Serial.printf("%s: push %.1f us, RAM blit %.2f us per sprite, %d wrong pixels\n", transformNames[kind],
+                      push.median, blitUs, wrong);
+    }
+
+    sprintf(buf, "%d wrong pixels", totalWrong);
+    displayText(buf, 10, 160, totalWrong == 0 ? TFT_GREEN : TFT_RED, 1);
+
+    free(expected);
+    free(readback);
+    waitForTouch();
+}
+
+void testB12_GlyphCache()
+{
+    clearScreen();
+    displayText("B12: Glyph Cache", 10, 10, TFT_CYAN);
+
+    // A HUD line of the kind redrawn every frame
+    char hud[40];
+    sprintf(hud, "GAMMA: 0x%02X | RAM: %lu KB", 0x01, (unsigned long)(ESP.getFreeHeap() / 1024));
+    int len = strlen(hud);
+
+    // Smooth font data stays in RAM while it is loaded
+    uint8_t *fontData = nullptr;
+    File fontFile = SD.open(GLYPH_FONT_FILE);
+    if (fontFile)
+    {
+        size_t size = fontFile.size();
+        fontData = (uint8_t *)malloc(size);
+        if (fontData && fontFile.read(fontData, size) != size)
+        {
+            free(fontData);
+            fontData = nullptr;
+        }
+        fontFile.close();
+    }
+    if (!fontData)
+        Serial.println("B12: no smooth font on SD, GLCD runs only");
+
+    struct FontCase
+    {
+        const char *label;
+        uint8_t size; // GLCD text size, 0 for the smooth font
+    };
+    const FontCase cases[] = {{"GLCD1", 1}, {"GLCD2", 2}, {"Smooth", 0}};
+    const int caseCount = fontData ? 3 : 2;
+
+    float directRate[3] = {}, cachedRate[3] = {};
+    int wrong[3] = {};
+    char resultName[32];
+
+    for (int c = 0; c < caseCount; c++)
+    {
+        if (cases[c].size)
+        {
+            tft.setTextFont(1);
+            tft.setTextSize(cases[c].size);
+        }
+        else
+        {
+            tft.setTextSize(1);
+            tft.loadFont(fontData);
+        }
+
+        // Direct print and cached draw one above the other, both over a
+        // filled background
+        int32_t directY = 40 + c * 50;
+        int32_t cachedY = directY + 22;
+        tft.setTextColor(TFT_YELLOW, TFT_NAVY);
+        int16_t h = tft.fontHeight();
+        int16_t w = min((int16_t)(tft.width() - 10), tft.textWidth(hud));
+        tft.fillRect(10, directY, w, h, TFT_NAVY);
+        tft.fillRect(10, cachedY, w, h, TFT_NAVY);
+
+        BenchStats direct = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                                     {
+                                         tft.setCursor(10, directY);
+                                         tft.print(hud);
+                                     });
+
+        GlyphCache cache;
+        unsigned long start = micros();
+        bool built = cache.build(tft, hud, TFT_YELLOW, TFT_NAVY, GLYPH_SCRATCH_X, GLYPH_SCRATCH_Y);
+        unsigned long buildTime = micros() - start;
+        tft.fillRect(GLYPH_SCRATCH_X, GLYPH_SCRATCH_Y, 2 * h, h, TFT_BLACK);
+
+        BenchStats cached = {};
+        if (built)
+        {
+            cached = benchRun(BENCH_WARMUP, BENCH_ITERATIONS, [&]()
+                              { cache.drawString(tft, hud, 10, cachedY); });
+
+            // Both copies read back and compared
+            uint16_t *a = (uint16_t *)malloc((size_t)w * h * 2);
+            uint16_t *b = (uint16_t *)malloc((size_t)w * h * 2);
+            if (a && b)
+            {
+                tft.readRect(10, directY, w, h, a);
+                tft.readRect(10, cachedY, w, h, b);
+                for (int32_t i = 0; i < (int32_t)w * h; i++)
+                {
+                    if (a[i] != b[i])
+                        wrong[c]++;
+                }
+            }
+            free(a);
+            free(b);
+        }
+        else
+        {
+            wrong[c] = -1;
+        }
+
+        directRate[c] = direct.median > 0 ? len * 1e6 / direct.median : 0;
+        cachedRate[c] = cached.median > 0 ? len * 1e6 / cached.median : 0;
+
+        sprintf(resultName, "B12_%s_Print", cases[c].label);
+        addResult(resultName, directRate[c], "chars/s");
+        sprintf(resultName, "B12_%s_Cached", cases[c].label);
+        addResult(resultName, cachedRate[c], "chars/s");
+        sprintf(resultName, "B12_%s_Build", cases[c].label);
+        addResult(resultName, buildTime, "us");
+        sprintf(resultName, "B12_%s_Bytes", cases[c].label);
+        addResult(resultName, cache.bytes(), "bytes");
+
+        Serial.printf("%s: print %.0f chars/s, cached %.0f chars/s (%.1fx), build %lu us, %u bytes, %d pixels differ\n",
+                      cases[c].label, directRate[c], cachedRate[c], directRate[c] > 0 ? cachedRate[c] / directRate[c] : 0,
+                      buildTime, (unsigned)cache.bytes(), wrong[c]);
+
+        if (!cases[c].size)
+            tft.unloadFont();
+    }
+    tft.setTextSize(1);
+    free(fontData);
+
+    clearScreen();
+    displayText("B12: Glyph Cache", 10, 10, TFT_CYAN);
+    char buf[60];
+    sprintf(buf, "\"%s\"", hud);
+    displayText(buf, 10, 40, TFT_WHITE, 1);
+    for (int c = 0; c < caseCount; c++)
+    {
+        sprintf(buf, "%-6s %7.0f -> %7.0f chars/s", cases[c].label, directRate[c], cachedRate[c]);
+        displayText(buf, 10, 65 + c * 20, TFT_GREEN, 1);
+        sprintf(buf, "%d px differ", wrong[c]);
+        displayText(buf, 220, 65 + c * 20, wrong[c] == 0 ? TFT_WHITE : TFT_ORANGE, 1);
+    }
+    if (!fontData)
+        displayText("No smooth font on SD", 10, 130, TFT_RED, 1);
+
+    waitForTouch();
+}
+
+// ============================================================================
+// PART C: PERFORMANCE STRESS TESTS
+// ============================================================================
+
+// pushImage() split into its address window and pixel transfers so the
+// profiler can time each; same bus traffic. Sprites crossing the screen
+// edge go through pushImage() for its clipping and count as push time, as
+// do mirrored sprites, which set their window inside pushImageFlipped().
+void pushImageProfiled(FrameProfiler &profiler, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data,
+                       bool mirrored = false)
+{
+    if (mirrored)
+    {
+        pushImageFlipped(tft, x, y, w, h, data);
+    }
+    else if (x >= 0 && y >= 0 && x + w <= tft.width() && y + h <= tft.height())
+    {
+        tft.startWrite();
+        tft.setAddrWindow(x, y, w, h);
+        profiler.mark(PHASE_ADDR_WINDOW);
+        tft.pushPixels(data, w * h);
+        tft.endWrite();
+    }
+    else
+    {
+        tft.pushImage(x, y, w, h, data);
+    }
+    profiler.mark(PHASE_PUSH);
+}
+
+void testC1_SpriteFPS()
+{
+    clearScreen();
+    displayText("C1: FPS Stress Test", 10, 10, TFT_CYAN);
+
+    // Bluegill sprite from the asset cache
+    uint16_t *fish = assets.pin(BLUEGILL_RGB565, BLUEGILL_BYTES);
+    if (!fish)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    int spriteCounts[] = {5, 10, 15, 20, 25};
+    tft.setSwapBytes(true);
+
+    static FrameProfiler profiler;
+
+    // Queued path: the fish in panel byte order, facing right and mirrored
+    // like the blocking path draws them, and a black block of the same size
+    // to erase them, all sent by DMA straight from these copies. The batch
+    // holds an erase and a draw for each of the largest sprite count.
+    SpriteBatch batch;
+    uint16_t *fishWire = (uint16_t *)malloc(BLUEGILL_BYTES);
+    uint16_t *fishWireFlipped = (uint16_t *)malloc(BLUEGILL_BYTES);
+    uint16_t *blank = (uint16_t *)calloc(BLUEGILL_WIDTH * BLUEGILL_HEIGHT, 2);
+    bool queuedPath = false;
+    if (fishWire && fishWireFlipped && blank)
+    {
+        for (int i = 0; i < BLUEGILL_WIDTH * BLUEGILL_HEIGHT; i++)
+            fishWire[i] = (fish[i] >> 8) | (fish[i] << 8);
+        blitFlipped(fishWireFlipped, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, 0, 0, fishWire, BLUEGILL_WIDTH, BLUEGILL_HEIGHT);
+        tft.initDMA();
+        queuedPath = batch.begin(tft, 2 * 25);
+    }
+    if (!queuedPath)
+        Serial.println("C1: queued SPI path unavailable, blocking only");
+    BenchSampler queuedFrames(FRAME_SAMPLES);
+    BenchSampler queuedCpu(FRAME_SAMPLES);
+
+    // Taps during the test: time from the touch IRQ to the render loop
+    // picking the event up, under full rendering load
+    BenchSampler touchLatency(64);
+
+    for (int countIdx = 0; countIdx < 5; countIdx++)
+    {
+        int numSprites = spriteCounts[countIdx];
+        profiler.begin(FRAME_HIST_BIN_US);
+        touch.flush();
+
+        // Initialize sprite positions
+        for (int i = 0; i < numSprites; i++)
+        {
+            sprites[i].x = random(0, SCREEN_WIDTH - BLUEGILL_WIDTH);
+            sprites[i].y = random(0, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+            sprites[i].dx = random(1, 4);
+            sprites[i].dy = random(1, 4);
+            sprites[i].active = true;
+        }
+
+        // Run for 3 seconds
+        unsigned long start = millis();
+        int frames = 0;
+
+        while (millis() - start < 3000)
+        {
+            profiler.startFrame();
+            tft.fillScreen(TFT_BLACK);
+            profiler.mark(PHASE_CLEAR);
+
+            TouchEvent event;
+            while (touch.poll(event))
+            {
+                if (event.type == TOUCH_DOWN)
+                    touchLatency.add(micros() - event.irqUs);
+            }
+            profiler.mark(PHASE_UPDATE);
+
+            // Move and draw sprites
+            for (int i = 0; i < numSprites; i++)
+            {
+                moveSprite(sprites[i], SCREEN_WIDTH - BLUEGILL_WIDTH, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+                profiler.mark(PHASE_UPDATE);
+                pushImageProfiled(profiler, sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, fish,
+                                  sprites[i].dx < 0);
+            }
+
+            profiler.endFrame();
+            frames++;
+        }
+
+        float fps = frames / 3.0;
+        BenchStats frameStats = profiler.frameStats();
+
+        // Same scene with the whole frame queued as SPI transactions: each
+        // fish's last position is erased with the black block rather than a
+        // blocking fillScreen, then every fish is drawn, and the CPU moves
+        // the next frame's sprites while DMA drains the queue. CPU time is
+        // the frame less any time blocked on SPI, where the blocking path
+        // spends the whole frame on the CPU.
+        float queuedFps = 0;
+        if (queuedPath)
+        {
+            queuedFrames.clear();
+            queuedCpu.clear();
+            int16_t drawnX[25], drawnY[25];
+            for (int i = 0; i < numSprites; i++)
+            {
+                drawnX[i] = sprites[i].x;
+                drawnY[i] = sprites[i].y;
+            }
+            tft.fillScreen(TFT_BLACK);
+
+            // An image the batch can't take is drawn blocking once the
+            // queue has drained; all of that counts as time on the bus
+            uint32_t blockedUs = 0;
+            auto queueOrDraw = [&](int16_t x, int16_t y, const uint16_t *wire, bool mirrored)
+            {
+                if (batch.push(x, y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, wire))
+                    return;
+                unsigned long blockStart = micros();
+                batch.wait();
+                if (wire == blank)
+                    tft.fillRect(x, y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, TFT_BLACK);
+                else if (mirrored)
+                    pushImageFlipped(tft, x, y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, fish);
+                else
+                    tft.pushImage(x, y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, fish);
+                blockedUs += micros() - blockStart;
+            };
+
+            start = millis();
+            int batchFrames = 0;
+            unsigned long frameStart = micros();
+
+            while (millis() - start < 3000)
+            {
+                for (int i = 0; i < numSprites; i++)
+                    moveSprite(sprites[i], SCREEN_WIDTH - BLUEGILL_WIDTH, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+
+                blockedUs = batch.wait();
+                for (int i = 0; i < numSprites; i++)
+                    queueOrDraw(drawnX[i], drawnY[i], blank, false);
+                for (int i = 0; i < numSprites; i++)
+                {
+                    bool mirrored = sprites[i].dx < 0;
+                    queueOrDraw(sprites[i].x, sprites[i].y, mirrored ? fishWireFlipped : fishWire, mirrored);
+                    drawnX[i] = sprites[i].x;
+                    drawnY[i] = sprites[i].y;
+                }
+
+                unsigned long now = micros();
+                queuedFrames.add(now - frameStart);
+                queuedCpu.add(now - frameStart - blockedUs);
+                frameStart = now;
+                batchFrames++;
+            }
+            batch.wait();
+            queuedFps = batchFrames / 3.0;
+        }
+
+        // Display result
+        clearScreen();
+        displayText("C1: FPS Test", 10, 10, TFT_CYAN);
+        char buf[50];
+        sprintf(buf, "%d sprites:", numSprites);
+        displayText(buf, 10, 50, TFT_WHITE);
+        sprintf(buf, "%.1f FPS", fps);
+        displayText(buf, 10, 80, TFT_YELLOW, 4);
+        if (queuedPath)
+        {
+            sprintf(buf, "Queued: %.1f FPS", queuedFps);
+            displayText(buf, 10, 120, TFT_GREEN);
+        }
+
+        char resultName[32];
+        snprintf(resultName, sizeof(resultName), "C1_FPS_%d", numSprites);
+        addResult(resultName, fps, "FPS");
+        snprintf(resultName, sizeof(resultName), "C1_Frame_%d", numSprites);
+        addResult(resultName, frameStats, "us");
+
+        Serial.print(numSprites);
+        Serial.print(" sprites: ");
+        Serial.print(fps);
+        Serial.println(" FPS");
+        profiler.printReport(resultName);
+
+        if (queuedPath)
+        {
+            BenchStats cpu = queuedCpu.stats();
+            snprintf(resultName, sizeof(resultName), "C1_Queued_FPS_%d", numSprites);
+            addResult(resultName, queuedFps, "FPS");
+            snprintf(resultName, sizeof(resultName), "C1_Queued_Frame_%d", numSprites);
+            addResult(resultName, queuedFrames.stats(), "us");
+            snprintf(resultName, sizeof(resultName), "C1_Queued_CPU_%d", numSprites);
+            addResult(resultName, cpu, "us");
+            Serial.printf("  Queued: %.2f FPS, CPU %u us/frame (blocking %u us)\n",
+                          queuedFps, (unsigned)cpu.median, (unsigned)frameStats.median);
+        }
+
+        delay(1500);
+    }
+
+    batch.end();
+    tft.deInitDMA();
+    free(fishWire);
+    free(fishWireFlipped);
+    free(blank);
+
+    if (touchLatency.size() > 0)
+    {
+        BenchStats latency = touchLatency.stats();
+        addResult("C1_Touch_Latency", latency, "us");
+        TouchStats ts = touch.getStats();
+        Serial.printf("Touch: %u taps, median %u us IRQ to dequeue (%u bounces, %u dropped)\n",
+                      (unsigned)latency.n, (unsigned)latency.median, (unsigned)ts.bounces, (unsigned)ts.dropped);
+    }
+
+    assets.unpin(BLUEGILL_RGB565);
+}
+
+void testC3_DirtyRectangles()
+{
+    clearScreen();
+    displayText("C3: Dirty Rect Test", 10, 10, TFT_CYAN);
+
+    // Same sprite and movement as C1, but only damaged areas are repainted
+    uint16_t *fish = assets.pin(BLUEGILL_RGB565, BLUEGILL_BYTES);
+    if (!fish)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    int spriteCounts[] = {5, 10, 15, 20, 25};
+    tft.setSwapBytes(true);
+
+    static DirtyRectRenderer renderer;
+    BenchSampler frameTimes(FRAME_SAMPLES);
+
+    for (int countIdx = 0; countIdx < 5; countIdx++)
+    {
+        int numSprites = spriteCounts[countIdx];
+        frameTimes.clear();
+
+        for (int i = 0; i < numSprites; i++)
+        {
+            sprites[i].x = random(0, SCREEN_WIDTH - BLUEGILL_WIDTH);
+            sprites[i].y = random(0, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+            sprites[i].dx = random(1, 4);
+            sprites[i].dy = random(1, 4);
+            sprites[i].active = true;
+        }
+
+        // One full frame to start from, then damage only
+        renderer.begin(tft.width(), tft.height(), TFT_BLACK);
+        tft.fillScreen(TFT_BLACK);
+        for (int i = 0; i < numSprites; i++)
+        {
+            tft.pushImage(sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, fish);
+        }
+
+        unsigned long start = millis();
+        int frames = 0;
+        uint64_t totalBytes = 0;
+
+        while (millis() - start < 3000)
+        {
+            unsigned long frameStart = micros();
+            for (int i = 0; i < numSprites; i++)
+            {
+                int16_t oldX = sprites[i].x;
+                int16_t oldY = sprites[i].y;
+                moveSprite(sprites[i], SCREEN_WIDTH - BLUEGILL_WIDTH, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+                renderer.addMove(oldX, oldY, sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT);
+            }
+
+            totalBytes += renderer.flush(tft, sprites, numSprites, fish, BLUEGILL_WIDTH, BLUEGILL_HEIGHT);
+            frameTimes.add(micros() - frameStart);
+            frames++;
+        }
+
+        float fps = frames / 3.0;
+        uint32_t bytesPerFrame = frames ? totalBytes / frames : 0;
+
+        // What C1 sends per frame: full clear plus every sprite
+        uint32_t fullBytes = (uint32_t)tft.width() * tft.height() * 2 + numSprites * BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2;
+
+        clearScreen();
+        displayText("C3: Dirty Rect Test", 10, 10, TFT_CYAN);
+        char buf[50];
+        sprintf(buf, "%d sprites:", numSprites);
+        displayText(buf, 10, 50, TFT_WHITE);
+        sprintf(buf, "%.1f FPS", fps);
+        displayText(buf, 10, 80, TFT_YELLOW, 4);
+        sprintf(buf, "%lu B/frame (C1: %lu)", (unsigned long)bytesPerFrame, (unsigned long)fullBytes);
+        displayText(buf, 10, 130, TFT_WHITE, 1);
+
+        char resultName[24];
+        snprintf(resultName, sizeof(resultName), "C3_FPS_%d", numSprites);
+        addResult(resultName, fps, "FPS");
+        snprintf(resultName, sizeof(resultName), "C3_Frame_%d", numSprites);
+        addResult(resultName, frameTimes.stats(), "us");
+        snprintf(resultName, sizeof(resultName), "C3_Bytes_%d", numSprites);
+        addResult(resultName, bytesPerFrame, "B/frame");
+
+        Serial.print(numSprites);
+        Serial.print(" sprites (dirty rects): ");
+        Serial.print(fps);
+        Serial.print(" FPS, ");
+        Serial.print(bytesPerFrame);
+        Serial.print(" bytes/frame vs ");
+        Serial.print(fullBytes);
+        Serial.println(" full redraw");
+
+        delay(1500);
+    }
+
+    assets.unpin(BLUEGILL_RGB565);
+}
+
+void testC2_BackgroundPlusSprites()
+{
+    clearScreen();
+    displayText("C2: BG + Sprites Test", 10, 10, TFT_CYAN);
+
+    // Load assets
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+    uint16_t *fish = assets.pin(BLUEGILL_RGB565, BLUEGILL_BYTES);
+    if (!background || !fish)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        assets.unpin(BACKGROUND_RGB565);
+        assets.unpin(BLUEGILL_RGB565);
+        waitForTouch();
+        return;
+    }
+
+    // Initialize 10 sprites
+    for (int i = 0; i < 10; i++)
+    {
+        sprites[i].x = random(0, BACKGROUND_WIDTH - BLUEGILL_WIDTH);
+        sprites[i].y = random(0, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT);
+        sprites[i].dx = random(1, 3);
+        sprites[i].dy = random(1, 3);
+        sprites[i].active = true;
+    }
+
+    tft.setSwapBytes(true);
+    static FrameProfiler profiler;
+    profiler.begin(FRAME_HIST_BIN_US);
+    unsigned long start = millis();
+    int frames = 0;
+
+    while (millis() - start < 5000)
+    {
+        profiler.startFrame();
+
+        // Draw background (the "clear" of this scene)
+        tft.pushImage(0, 0, BACKGROUND_WIDTH, BACKGROUND_HEIGHT, background);
+        profiler.mark(PHASE_CLEAR);
+
+        // Move and draw sprites
+        for (int i = 0; i < 10; i++)
+        {
+            moveSprite(sprites[i], BACKGROUND_WIDTH - BLUEGILL_WIDTH, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT);
+            profiler.mark(PHASE_UPDATE);
+            pushImageProfiled(profiler, sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, fish,
+                              sprites[i].dx < 0);
+        }
+
+        profiler.endFrame();
+        frames++;
+    }
+
+    float fps = frames / 5.0;
+
+    // Display result
+    clearScreen();
+    displayText("C2: BG + Sprites", 10, 10, TFT_CYAN);
+    char buf[50];
+    displayText("Background + 10 fish", 10, 50, TFT_WHITE);
+    sprintf(buf, "%.1f FPS", fps);
+    displayText(buf, 10, 80, TFT_YELLOW, 4);
+
+    addResult("C2_BG_Sprites_FPS", fps, "FPS");
+    addResult("C2_BG_Sprites_Frame", profiler.frameStats(), "us");
+
+    Serial.print("Background + 10 sprites: ");
+    Serial.print(fps);
+    Serial.println(" FPS");
+    profiler.printReport("C2_BG_Sprites");
+
+    assets.unpin(BACKGROUND_RGB565);
+    assets.unpin(BLUEGILL_RGB565);
+    waitForTouch();
+}
+
+void testC2_BandCompositorDMA()
+{
+    clearScreen();
+    displayText("C2-DMA: Band Compositor", 10, 10, TFT_CYAN);
+
+    // Same scene as C2, composed in RAM bands and pushed with DMA
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+    uint16_t *fish = assets.pin(BLUEGILL_RGB565, BLUEGILL_BYTES);
+    if (!background || !fish)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        assets.unpin(BACKGROUND_RGB565);
+        assets.unpin(BLUEGILL_RGB565);
+        waitForTouch();
+        return;
+    }
+
+    static BandCompositor compositor;
+    if (!compositor.begin(BACKGROUND_WIDTH, C2_BAND_HEIGHT))
+    {
+        displayText("BAND MALLOC FAILED!", 10, 50, TFT_RED);
+        Serial.println("C2-DMA: band buffer allocation failed");
+        assets.unpin(BACKGROUND_RGB565);
+        assets.unpin(BLUEGILL_RGB565);
+        waitForTouch();
+        return;
+    }
+
+    for (int i = 0; i < 10; i++)
+    {
+        sprites[i].x = random(0, BACKGROUND_WIDTH - BLUEGILL_WIDTH);
+        sprites[i].y = random(0, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT);
+        sprites[i].dx = random(1, 3);
+        sprites[i].dy = random(1, 3);
+        sprites[i].active = true;
+    }
+
+    tft.setSwapBytes(true);
+    tft.initDMA();
+    tft.startWrite();
+
+    BenchSampler frameTimes(FRAME_SAMPLES);
+    unsigned long start = millis();
+    int frames = 0;
+    uint64_t totalBytes = 0;
+
+    while (millis() - start < 5000)
+    {
+        unsigned long frameStart = micros();
+        for (int i = 0; i < 10; i++)
+        {
+            moveSprite(sprites[i], BACKGROUND_WIDTH - BLUEGILL_WIDTH, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT);
+        }
+
+        totalBytes += compositor.renderFrame(tft, 0, 0, background, BACKGROUND_HEIGHT,
+                                             sprites, 10, fish, BLUEGILL_WIDTH, BLUEGILL_HEIGHT);
+        frameTimes.add(micros() - frameStart);
+        frames++;
+    }
+
+    tft.dmaWait();
+    tft.endWrite();
+    tft.deInitDMA();
+    compositor.end();
+
+    float fps = frames / 5.0;
+    uint32_t bytesPerFrame = frames ? totalBytes / frames : 0;
+
+    // What C2 sends per frame: full background plus every sprite on top
+    uint32_t overdrawBytes = BACKGROUND_WIDTH * BACKGROUND_HEIGHT * 2 + 10 * BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2;
+
+    clearScreen();
+    displayText("C2-DMA: BG + Sprites", 10, 10, TFT_CYAN);
+    char buf[50];
+    sprintf(buf, "Band %dpx, 10 fish", C2_BAND_HEIGHT);
+    displayText(buf, 10, 50, TFT_WHITE);
+    sprintf(buf, "%.1f FPS", fps);
+    displayText(buf, 10, 80, TFT_YELLOW, 4);
+    sprintf(buf, "%lu B/frame (C2: %lu)", (unsigned long)bytesPerFrame, (unsigned long)overdrawBytes);
+    displayText(buf, 10, 130, TFT_WHITE, 1);
+
+    char resultName[20];
+    sprintf(resultName, "C2_DMA_B%d_FPS", C2_BAND_HEIGHT);
+    addResult(resultName, fps, "FPS");
+    sprintf(resultName, "C2_DMA_B%d_Frame", C2_BAND_HEIGHT);
+    addResult(resultName, frameTimes.stats(), "us");
+
+    Serial.print("Background + 10 sprites (DMA bands of ");
+    Serial.print(C2_BAND_HEIGHT);
+    Serial.print(" rows): ");
+    Serial.print(fps);
+    Serial.print(" FPS, ");
+    Serial.print(bytesPerFrame);
+    Serial.print(" bytes/frame vs ");
+    Serial.print(overdrawBytes);
+    Serial.println(" with overdraw");
+
+    assets.unpin(BACKGROUND_RGB565);
+    assets.unpin(BLUEGILL_RGB565);
+    waitForTouch();
+}
+
+void testC2_AlphaBlend()
+{
+    clearScreen();
+    displayText("C2-Alpha: Blended Sprites", 10, 10, TFT_CYAN);
+
+    // C2-DMA's scene, with the fish alpha blended into the bands instead of
+    // cut out with a transparent colour key
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+    AlphaSprite fish;
+    if (!background || !loadAlphaSpriteFromSD(BLUEGILL_A565, fish))
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        assets.unpin(BACKGROUND_RGB565);
+        waitForTouch();
+        return;
+    }
+
+    // Fish swimming left face left, as in C2 and C2-DMA
+    AlphaSprite fishFlipped;
+    if (!mirrorAlphaSprite(fish, fishFlipped))
+    {
+        displayText("MALLOC FAILED!", 10, 50, TFT_RED);
+        freeAlphaSprite(fish);
+        assets.unpin(BACKGROUND_RGB565);
+        waitForTouch();
+        return;
+    }
+
+    static BandCompositor compositor;
+    if (!compositor.begin(BACKGROUND_WIDTH, C2_BAND_HEIGHT))
+    {
+        displayText("BAND MALLOC FAILED!", 10, 50, TFT_RED);
+        Serial.println("C2-Alpha: band buffer allocation failed");
+        freeAlphaSprite(fish);
+        freeAlphaSprite(fishFlipped);
+        assets.unpin(BACKGROUND_RGB565);
+        waitForTouch();
+        return;
+    }
+
+    // Pixels that need a real blend (neither transparent nor opaque)
+    int edgePixels = 0;
+    uint8_t opaque = fish.alphaBits == 8 ? 0xFF : 0x0F;
+    int pitch = fish.alphaBits == 8 ? fish.width : (fish.width + 1) / 2;
+    for (int y = 0; y < fish.height; y++)
+    {
+        for (int x = 0; x < fish.width; x++)
+        {
+            uint8_t a = fish.alphaBits == 8 ? fish.alpha[y * pitch + x]
+                                            : (fish.alpha[y * pitch + x / 2] >> ((x & 1) * 4)) & 0x0F;
+            if (a != 0 && a != opaque)
+                edgePixels++;
+        }
+    }
+
+    for (int i = 0; i < 10; i++)
+    {
+        sprites[i].x = random(0, BACKGROUND_WIDTH - fish.width);
+        sprites[i].y = random(0, BACKGROUND_HEIGHT - fish.height);
+        sprites[i].dx = random(1, 3);
+        sprites[i].dy = random(1, 3);
+        sprites[i].active = true;
+    }
+
+    tft.setSwapBytes(true);
+    tft.initDMA();
+    tft.startWrite();
+
+    BenchSampler frameTimes(FRAME_SAMPLES);
+    unsigned long start = millis();
+    int frames = 0;
+
+    while (millis() - start < 5000)
+    {
+        unsigned long frameStart = micros();
+        for (int i = 0; i < 10; i++)
+        {
+            moveSprite(sprites[i], BACKGROUND_WIDTH - fish.width, BACKGROUND_HEIGHT - fish.height);
+        }
+
+        compositor.renderFrame(tft, 0, 0, background, BACKGROUND_HEIGHT, sprites, 10, fish, &fishFlipped);
+        frameTimes.add(micros() - frameStart);
+        frames++;
+    }
+
+    tft.dmaWait();
+    tft.endWrite();
+    tft.deInitDMA();
+    compositor.end();
+
+    float fps = frames / 5.0;
+
+    clearScreen();
+    displayText("C2-Alpha: BG + Sprites", 10, 10, TFT_CYAN);
+    char buf[50];
+    sprintf(buf, "Band %dpx, 10 fish, %d-bit alpha", C2_BAND_HEIGHT, fish.alphaBits);
+    displayText(buf, 10, 50, TFT_WHITE, 1);
+    sprintf(buf, "%.1f FPS", fps);
+    displayText(buf, 10, 80, TFT_YELLOW, 4);
+    sprintf(buf, "%d blended px per fish", edgePixels);
+    displayText(buf, 10, 130, TFT_WHITE, 1);
+    if (edgePixels == 0)
+    {
+        displayText("NO SOFT EDGES: BLEND NOT TIMED", 10, 145, TFT_RED, 1);
+        displayText("Rebuild the .a565 with --feather", 10, 160, TFT_YELLOW, 1);
+        Serial.println("C2-Alpha: sprite alpha is all 0 or opaque, only the skip and copy paths ran");
+    }
+
+    addResult("C2_Alpha_FPS", fps, "FPS");
+    addResult("C2_Alpha_Frame", frameTimes.stats(), "us");
+    addResult("C2_Alpha_Edge_Pixels", edgePixels, "px");
+
+    Serial.print("Background + 10 alpha blended sprites (");
+    Serial.print(fish.alphaBits);
+    Serial.print("-bit alpha, ");
+    Serial.print(edgePixels);
+    Serial.print(" edge pixels each): ");
+    Serial.print(fps);
+    Serial.println(" FPS");
+
+    freeAlphaSprite(fish);
+    freeAlphaSprite(fishFlipped);
+    assets.unpin(BACKGROUND_RGB565);
+    waitForTouch();
+}
+
+// Draws the C2 scene from pipeline commands for durationMs, sampling the
+// time between finished frames. waits counts frames that found the ring
+// empty at least once. Returns frames drawn.
+int renderPipelineScene(SpritePipeline &pipeline, uint16_t *background, unsigned long durationMs,
+                        BenchSampler &frameTimes, int &waits)
+{
+    PipelineCommand cmd;
+    uint16_t *image = nullptr;
+    int16_t imageW = 0, imageH = 0;
+    int frames = 0;
+    bool waited = false;
+    unsigned long lastFrame = 0;
+    unsigned long start = millis();
+
+    while (millis() - start < durationMs)
+    {
+        if (!pipeline.next(cmd))
+        {
+            waited = true;
+            yield();
+            continue;
+        }
+
+        // New sprite image: switch to it and give the old one back
+        if (cmd.type == PIPELINE_SPRITE)
+        {
+            pipeline.release(image);
+            image = cmd.image;
+            imageW = cmd.width;
+            imageH = cmd.height;
+            continue;
+        }
+
+        tft.pushImage(0, 0, BACKGROUND_WIDTH, BACKGROUND_HEIGHT, background);
+        if (image)
+        {
+            for (int i = 0; i < cmd.count; i++)
+            {
+                tft.pushImage(cmd.sprites[i].x, cmd.sprites[i].y, imageW, imageH, image);
+            }
+        }
+
+        // Frame-to-frame time, so inline loads and ring waits both count
+        unsigned long now = micros();
+        if (frames > 0)
+        {
+            frameTimes.add(now - lastFrame);
+            if (waited)
+                waits++;
+        }
+        lastFrame = now;
+        waited = false;
+        frames++;
+    }
+
+    pipeline.release(image);
+    return frames;
+}
+
+void testC4_DualCorePipeline()
+{
+    clearScreen();
+    displayText("C4: Dual-Core Pipeline", 10, 10, TFT_CYAN);
+
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+    if (!background)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    // Sprite images streamed from SD while the scene animates
+    static const PipelineAsset streamed[] = {
+        {BLUEGILL_RGB565, BLUEGILL_WIDTH, BLUEGILL_HEIGHT},
+        {"/sprite_tests/enemy_clanker_32x32.rgb565", CLANKER_WIDTH, CLANKER_HEIGHT},
+    };
+
+    for (int i = 0; i < 10; i++)
+    {
+        sprites[i].x = random(0, BACKGROUND_WIDTH - BLUEGILL_WIDTH);
+        sprites[i].y = random(0, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT);
+        sprites[i].dx = random(1, 3);
+        sprites[i].dy = random(1, 3);
+        sprites[i].active = true;
+    }
+
+    tft.setSwapBytes(true);
+
+    // Same scene and load schedule twice: loads inline in the render loop,
+    // then on a core 0 task feeding this loop (core 1) through the ring
+    static SpritePipeline pipeline;
+    BenchSampler frameTimes(FRAME_SAMPLES);
+    const char *labels[2] = {"Inline", "Pipe"};
+    uint32_t drops[2] = {0, 0};
+    float fps[2] = {0, 0};
+
+    for (int threaded = 0; threaded < 2; threaded++)
+    {
+        frameTimes.clear();
+        if (!pipeline.begin(sprites, 10, BACKGROUND_WIDTH - BLUEGILL_WIDTH, BACKGROUND_HEIGHT - BLUEGILL_HEIGHT,
+                            streamed, 2, BLUEGILL_BYTES, loadRGB565FromSD, PIPELINE_LOAD_INTERVAL, threaded))
+        {
+            displayText("PIPELINE START FAILED!", 10, 50, TFT_RED);
+            Serial.println("C4: pipeline buffers or loader task could not be created");
+            assets.unpin(BACKGROUND_RGB565);
+            waitForTouch();
+            return;
+        }
+
+        int waits = 0;
+        int frames = renderPipelineScene(pipeline, background, 5000, frameTimes, waits);
+        pipeline.end();
+
+        PipelineStats ps = pipeline.getStats();
+        BenchStats frame = frameTimes.stats();
+        fps[threaded] = frames / 5.0;
+        drops[threaded] = frameTimes.countAbove(frame.median * PIPELINE_DROP_FACTOR);
+
+        char resultName[24];
+        sprintf(resultName, "C4_%s_FPS", labels[threaded]);
+        addResult(resultName, fps[threaded], "FPS");
+        sprintf(resultName, "C4_%s_Frame", labels[threaded]);
+        addResult(resultName, frame, "us");
+        sprintf(resultName, "C4_%s_Drops", labels[threaded]);
+        addResult(resultName, drops[threaded], "frames");
+        if (threaded)
+        {
+            addResult("C4_Pipe_Waits", waits, "frames");
+            addResult("C4_Pipe_Loads", ps.loads, "");
+        }
+
+        Serial.print(labels[threaded]);
+        Serial.print(": ");
+        Serial.print(fps[threaded]);
+        Serial.print(" FPS, p99 frame ");
+        Serial.print(frame.p99);
+        Serial.print(" us, ");
+        Serial.print(drops[threaded]);
+        Serial.print(" drops, ");
+        Serial.print(ps.loads);
+        Serial.print(" loads, renderer waited ");
+        Serial.print(waits);
+        Serial.print(" frames, ring full ");
+        Serial.print(ps.producerStalls);
+        Serial.println(" times");
+    }
+
+    clearScreen();
+    displayText("C4: Dual-Core Pipeline", 10, 10, TFT_CYAN);
+    char buf[50];
+    sprintf(buf, "SD load every %d frames", PIPELINE_LOAD_INTERVAL);
+    displayText(buf, 10, 50, TFT_WHITE, 1);
+    sprintf(buf, "Inline: %.1f FPS, %lu drops", fps[0], (unsigned long)drops[0]);
+    displayText(buf, 10, 80, drops[0] ? TFT_RED : TFT_GREEN);
+    sprintf(buf, "Pipe:   %.1f FPS, %lu drops", fps[1], (unsigned long)drops[1]);
+    displayText(buf, 10, 110, drops[1] ? TFT_RED : TFT_GREEN);
+
+    assets.unpin(BACKGROUND_RGB565);
+    waitForTouch();
+}
+
+// The naive version: every sprite against every other
+uint32_t bruteForcePairs(const Sprite *objs, int count, int16_t w, int16_t h, GridPair *pairs, uint32_t maxPairs)
+{
+    uint32_t found = 0;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = i + 1; j < count; j++)
+        {
+            if (objs[i].x < objs[j].x + w && objs[j].x < objs[i].x + w &&
+                objs[i].y < objs[j].y + h && objs[j].y < objs[i].y + h)
+            {
+                if (found < maxPairs)
+                    pairs[found] = {(uint16_t)i, (uint16_t)j};
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+void testC5_Broadphase()
+{
+    clearScreen();
+    displayText("C5: Broadphase", 10, 10, TFT_CYAN);
+
+    int16_t fieldW = tft.width();
+    int16_t fieldH = tft.height();
+    int most = broadphaseCounts[BROADPHASE_STEPS - 1];
+
+    // Objects no larger than a cell touch at most 4 cells
+    SpatialGrid grid;
+    Sprite *objs = (Sprite *)malloc(most * sizeof(Sprite));
+    GridPair *pairs = (GridPair *)malloc(BROADPHASE_MAX_PAIRS * sizeof(GridPair));
+    bool ready = objs && pairs && grid.begin(fieldW, fieldH, BROADPHASE_CELL_SHIFT, most);
+    if (!ready)
+    {
+        free(objs);
+        free(pairs);
+        displayText("MALLOC FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    char buf[60];
+    char resultName[24];
+    for (int step = 0; step < BROADPHASE_STEPS; step++)
+    {
+        int n = broadphaseCounts[step];
+        for (int i = 0; i < n; i++)
+        {
+            objs[i].x = random(0, fieldW - BROADPHASE_SIZE);
+            objs[i].y = random(0, fieldH - BROADPHASE_SIZE);
+            objs[i].dx = random(1, 4);
+            objs[i].dy = random(1, 4);
+            objs[i].active = true;
+        }
+        grid.clear();
+
+        BenchSampler gridTimes(BROADPHASE_FRAMES), bruteTimes(BROADPHASE_FRAMES);
+        BenchSampler gridQueries(BROADPHASE_FRAMES), bruteQueries(BROADPHASE_FRAMES);
+        BenchSampler pairCounts(BROADPHASE_FRAMES);
+        int mismatches = 0;
+        int16_t qx[BROADPHASE_QUERIES], qy[BROADPHASE_QUERIES];
+        uint16_t ids[64];
+
+        for (int frame = 0; frame < BROADPHASE_FRAMES; frame++)
+        {
+            for (int i = 0; i < n; i++)
+                moveSprite(objs[i], fieldW - BROADPHASE_SIZE, fieldH - BROADPHASE_SIZE);
+            for (int q = 0; q < BROADPHASE_QUERIES; q++)
+            {
+                qx[q] = random(0, fieldW);
+                qy[q] = random(0, fieldH);
+            }
+
+            // Incremental grid update plus every overlapping pair
+            unsigned long start = micros();
+            for (int i = 0; i < n; i++)
+                grid.update(i, objs[i].x, objs[i].y, BROADPHASE_SIZE, BROADPHASE_SIZE);
+            uint32_t gridPairs = grid.findPairs(pairs, BROADPHASE_MAX_PAIRS);
+            gridTimes.add(micros() - start);
+
+            start = micros();
+            uint32_t brutePairs = bruteForcePairs(objs, n, BROADPHASE_SIZE, BROADPHASE_SIZE, pairs, BROADPHASE_MAX_PAIRS);
+            bruteTimes.add(micros() - start);
+            pairCounts.add(gridPairs);
+            if (gridPairs != brutePairs)
+                mismatches++;
+
+            // Alternating point and 32x32 area queries (a tap, a blast)
+            start = micros();
+            for (int q = 0; q < BROADPHASE_QUERIES; q++)
+            {
+                if (q & 1)
+                    grid.queryRect(qx[q] - 16, qy[q] - 16, 32, 32, ids, 64);
+                else
+                    grid.queryPoint(qx[q], qy[q], ids, 64);
+            }
+            gridQueries.add((float)(micros() - start) / BROADPHASE_QUERIES);
+
+            start = micros();
+            for (int q = 0; q < BROADPHASE_QUERIES; q++)
+            {
+                int16_t size = q & 1 ? 32 : 1;
+                int16_t left = q & 1 ? qx[q] - 16 : qx[q];
+                int16_t top = q & 1 ? qy[q] - 16 : qy[q];
+                int hits = 0;
+                for (int i = 0; i < n; i++)
+                {
+                    if (objs[i].x < left + size && left < objs[i].x + BROADPHASE_SIZE &&
+                        objs[i].y < top + size && top < objs[i].y + BROADPHASE_SIZE && hits < 64)
+                        ids[hits++] = i;
+                }
+            }
+            bruteQueries.add((float)(micros() - start) / BROADPHASE_QUERIES);
+        }
+
+        BenchStats gridStats = gridTimes.stats();
+        BenchStats bruteStats = bruteTimes.stats();
+        BenchStats gridQuery = gridQueries.stats();
+        BenchStats bruteQuery = bruteQueries.stats();
+        float refiled = grid.getUpdates() ? 100.0f * grid.getRefiles() / grid.getUpdates() : 0;
+
+        sprintf(buf, "%d: grid %lu us, brute %lu us", n, (unsigned long)gridStats.median,
+                (unsigned long)bruteStats.median);
+        displayText(buf, 10, 50 + step * 60, mismatches ? TFT_RED : TFT_GREEN, 1);
+        sprintf(buf, "pairs %lu, query %.1f vs %.1f us", (unsigned long)pairCounts.stats().median,
+                gridQuery.median, bruteQuery.median);
+        displayText(buf, 10, 65 + step * 60, TFT_WHITE, 1);
+
+        sprintf(resultName, "C5_Grid_%d", n);
+        addResult(resultName, gridStats, "us");
+        sprintf(resultName, "C5_Brute_%d", n);
+        addResult(resultName, bruteStats, "us");
+        sprintf(resultName, "C5_Query_Grid_%d", n);
+        addResult(resultName, gridQuery, "us");
+        sprintf(resultName, "C5_Query_Brute_%d", n);
+        addResult(resultName, bruteQuery, "us");
+        sprintf(resultName, "C5_Pairs_%d", n);
+        addResult(resultName, pairCounts.stats(), "pairs");
+
+        Serial.printf("%d sprites: grid %lu us/frame (%.1f%% of updates refiled), brute force %lu us, %lu pairs%s\n",
+                      n, (unsigned long)gridStats.median, refiled, (unsigned long)bruteStats.median,
+                      (unsigned long)pairCounts.stats().median, mismatches ? ", PAIR COUNT MISMATCH" : "");
+        Serial.printf("  queries: grid %.2f us, brute force %.2f us\n", gridQuery.median, bruteQuery.median);
+    }
+
+    grid.end();
+    free(pairs);
+    free(objs);
+    waitForTouch();
+}
+
+// HUD for C6, drawn in the fixed area at the head of the scroll axis
+void drawScrollHud(int frames, int32_t position)
+{
+    char buf[12];
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    sprintf(buf, "%5d", frames);
+    tft.drawString(buf, 2, 10, 1);
+    sprintf(buf, "%5ld", (long)position);
+    tft.drawString(buf, 2, 25, 1);
+}
+
+void testC6_HardwareScroll()
+{
+    clearScreen();
+    displayText("C6: Hardware Scroll", 10, 10, TFT_CYAN);
+
+    uint16_t *background = assets.pin(BACKGROUND_RGB565, BACKGROUND_BYTES);
+    if (!background)
+    {
+        displayText("ASSET LOAD FAILED!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    // The scroll runs along the panel's 320-pixel axis, x in this rotation,
+    // so the background scrolls sideways between two HUD strips
+    clearScreen();
+    tft.setSwapBytes(true);
+    int16_t area = tft.width() - 2 * SCROLL_HUD_LINES;
+    int16_t crossH = tft.height();
+
+    // Full repush: the whole scroll area from the background at the new
+    // offset, two pushes per row where it wraps
+    int32_t position = 0;
+    int frames = 0;
+    unsigned long start = millis();
+    while (millis() - start < SCROLL_TEST_MS)
+    {
+        position += SCROLL_SPEED;
+        int32_t col = position % BACKGROUND_WIDTH;
+        tft.startWrite();
+        tft.setAddrWindow(SCROLL_HUD_LINES, 0, area, crossH);
+        for (int16_t row = 0; row < crossH; row++)
+        {
+            const uint16_t *src = background + row * BACKGROUND_WIDTH;
+            tft.pushPixels(src + col, BACKGROUND_WIDTH - col);
+            if (col)
+                tft.pushPixels(src, col);
+        }
+        tft.endWrite();
+        drawScrollHud(++frames, position);
+    }
+    float repushFps = frames * 1000.0f / SCROLL_TEST_MS;
+    uint32_t repushBytes = 11 + (uint32_t)area * crossH * 2;
+
+    // Hardware scroll: fill the ring once, then each frame one VSCRSADR
+    // and the lines that scrolled in
+    HardwareScroller scroller;
+    bool scrollOk = scroller.begin(tft, SCROLL_HUD_LINES, SCROLL_HUD_LINES) && scroller.getLength() == BACKGROUND_WIDTH;
+    float scrollFps = 0;
+    uint32_t scrollBytes = 0;
+    if (scrollOk)
+    {
+        scroller.drawLines(0, scroller.getLength(), background, BACKGROUND_WIDTH, BACKGROUND_HEIGHT);
+        frames = 0;
+        uint64_t totalBytes = 0;
+        start = millis();
+        while (millis() - start < SCROLL_TEST_MS)
+        {
+            totalBytes += scroller.scroll(SCROLL_SPEED, background, BACKGROUND_WIDTH, BACKGROUND_HEIGHT);
+            drawScrollHud(++frames, scroller.getPosition());
+        }
+        scrollFps = frames * 1000.0f / SCROLL_TEST_MS;
+        scrollBytes = frames ? totalBytes / frames : 0;
+    }
+    scroller.end();
+
+    clearScreen();
+    displayText("C6: Hardware Scroll", 10, 10, TFT_CYAN);
+    char buf[60];
+    sprintf(buf, "Repush: %.1f FPS, %lu B/frame", repushFps, (unsigned long)repushBytes);
+    displayText(buf, 10, 50, TFT_WHITE, 1);
+    if (scrollOk)
+    {
+        sprintf(buf, "Scroll: %.1f FPS, %lu B/frame", scrollFps, (unsigned long)scrollBytes);
+        displayText(buf, 10, 70, TFT_GREEN, 1);
+        sprintf(buf, "%d lines/frame, %d-line scroll area", SCROLL_SPEED, area);
+        displayText(buf, 10, 90, TFT_WHITE, 1);
+    }
+    else
+    {
+        displayText("SCROLL AREA SETUP FAILED!", 10, 70, TFT_RED, 1);
+    }
+
+    addResult("C6_Repush_FPS", repushFps, "FPS");
+    addResult("C6_Repush_Bytes", repushBytes, "bytes");
+    addResult("C6_Scroll_FPS", scrollFps, "FPS");
+    addResult("C6_Scroll_Bytes", scrollBytes, "bytes");
+
+    Serial.printf("Background repush: %.1f FPS, %lu bytes/frame\n", repushFps, (unsigned long)repushBytes);
+    Serial.printf("Hardware scroll (%d lines/frame): %.1f FPS, %lu bytes/frame%s\n", SCROLL_SPEED, scrollFps,
+                  (unsigned long)scrollBytes, scrollOk ? "" : " (SETUP FAILED)");
+
+    assets.unpin(BACKGROUND_RGB565);
+    waitForTouch();
+}
+
+void testC7_AnimatedSprites()
+{
+    clearScreen();
+    displayText("C7: Animated Sprites", 10, 10, TFT_CYAN);
+
+    // The whole swim cycle is read once; every frame after that is a
+    // pointer into it
+    static SpriteAtlas atlas;
+    static AnimSheet sheet;
+    bool sheetOk = atlas.open("/sprite_tests/sprites.atlas") &&
+                   sheet.loadFromAtlas(atlas, SWIM_SHEET, BLUEGILL_WIDTH, BLUEGILL_HEIGHT);
+    atlas.close();
+    if (!sheetOk)
+    {
+        displayText("NO SWIM SHEET IN ATLAS!", 10, 50, TFT_RED);
+        waitForTouch();
+        return;
+    }
+
+    // A sheet with fewer frames than the clips use (make_sheet.py --wiggle
+    // 2) would leave fish with no pixels to draw
+    for (size_t c = 0; c < FISH_CLIPS; c++)
+    {
+        for (uint8_t f = 0; f < fishClips[c].count; f++)
+        {
+            if (fishClips[c].frames[f].index >= sheet.frameCount())
+            {
+                char buf[60];
+                sprintf(buf, "Clip %s needs frame %d", fishClips[c].name, fishClips[c].frames[f].index);
+                displayText(buf, 10, 50, TFT_RED, 1);
+                sprintf(buf, "Sheet has %d frames", sheet.frameCount());
+                displayText(buf, 10, 65, TFT_RED, 1);
+                Serial.printf("C7: clip %s needs frame %d, swim sheet has %d\n", fishClips[c].name,
+                              fishClips[c].frames[f].index, sheet.frameCount());
+                sheet.end();
+                waitForTouch();
+                return;
+            }
+        }
+    }
+
+    // Idle fish drift, darting ones hurry; each starts at a random point
+    // of its clip so they don't flap in step
+    const char *clipNames[] = {"swim", "idle", "dart"};
+    const int16_t clipSpeeds[] = {2, 1, 4};
+    static Animator animators[ANIM_FISH];
+    for (int i = 0; i < ANIM_FISH; i++)
+    {
+        int c = i % 3;
+        sprites[i].x = random(0, SCREEN_WIDTH - BLUEGILL_WIDTH);
+        sprites[i].y = random(0, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+        sprites[i].dx = random(0, 2) ? clipSpeeds[c] : -clipSpeeds[c];
+        sprites[i].dy = random(0, 2) ? 1 : -1;
+        sprites[i].active = true;
+        animators[i].play(findClip(fishClips, FISH_CLIPS, clipNames[c]), random(0, 1000));
+    }
+
+    tft.setSwapBytes(true);
+    BenchSampler frameTimes(FRAME_SAMPLES);
+    BenchSampler animTimes(FRAME_SAMPLES);
+    float cyclesPerUs = ESP.getCpuFreqMHz();
+    uint32_t frameChanges = 0;
+    unsigned long start = millis();
+    unsigned long last = start;
+    int frames = 0;
+
+    while (millis() - start < ANIM_TEST_MS)
+    {
+        unsigned long frameStart = micros();
+
+        // One delta for every fish. The update takes well under a
+        // microsecond, so it is timed with the cycle counter
+        unsigned long now = millis();
+        uint32_t updateStart = ESP.getCycleCount();
+        frameChanges += updateAnimators(animators, ANIM_FISH, now - last);
+        animTimes.add((float)(ESP.getCycleCount() - updateStart) / cyclesPerUs);
+        last = now;
+
+        tft.fillScreen(TFT_BLACK);
+        for (int i = 0; i < ANIM_FISH; i++)
+        {
+            moveSprite(sprites[i], SCREEN_WIDTH - BLUEGILL_WIDTH, SCREEN_HEIGHT - BLUEGILL_HEIGHT);
+            const uint16_t *pixels = sheet.frame(animators[i].frame());
+            if (sprites[i].dx < 0)
+                pushImageFlipped(tft, sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, pixels);
+            else
+                tft.pushImage(sprites[i].x, sprites[i].y, BLUEGILL_WIDTH, BLUEGILL_HEIGHT, pixels);
+        }
+
+        frameTimes.add(micros() - frameStart);
+        frames++;
+    }
+
+    float seconds = ANIM_TEST_MS / 1000.0;
+    float fps = frames / seconds;
+    BenchStats animStats = animTimes.stats();
+
+    clearScreen();
+    displayText("C7: Animated Sprites", 10, 10, TFT_CYAN);
+    char buf[60];
+    sprintf(buf, "%d fish, %d-frame sheet", ANIM_FISH, sheet.frameCount());
+    displayText(buf, 10, 50, TFT_WHITE);
+    sprintf(buf, "%.1f FPS", fps);
+    displayText(buf, 10, 80, TFT_YELLOW, 4);
+    sprintf(buf, "Animation: %.2f us/frame", animStats.median);
+    displayText(buf, 10, 130, TFT_GREEN, 1);
+    sprintf(buf, "%.0f frame changes/s", frameChanges / seconds);
+    displayText(buf, 10, 145, TFT_WHITE, 1);
+
+    addResult("C7_Anim_FPS", fps, "FPS");
+    addResult("C7_Anim_Frame", frameTimes.stats(), "us");
+    addResult("C7_Anim_Update", animStats, "us");
+
+    Serial.printf("%d animated fish: %.1f FPS, animation update %.2f us/frame (p99 %.2f), %.0f frame changes/s\n",
+                  ANIM_FISH, fps, animStats.median, animStats.p99, frameChanges / seconds);
+
+    sheet.end();
+    waitForTouch();
+}
+
+// ============================================================================
+// RESULTS DISPLAY
+// ============================================================================
+
+void displayResults()
+{
+    AssetCacheStats cache = assets.getStats();
+    addResult("Cache_Hits", cache.hits, "");
+    addResult("Cache_Misses", cache.misses, "");
+    addResult("Cache_Evictions", cache.evictions, "");
+    addResult("Cache_Failures", cache.failures, "");
+    addResult("Cache_Bytes", cache.bytesUsed, "bytes");
+
+    clearScreen();
+    displayText("=== TEST RESULTS ===", 10, 5, TFT_CYAN, 2);
+
+    // Median for repeated measurements, with p95 to show the spread
+    int y = 30;
+    for (size_t i = 0; i < benchResultCount() && y < 300; i++)
+    {
+        const BenchResult &r = benchResult(i);
+        char buf[80];
+        if (r.stats.n > 1)
+            sprintf(buf, "%s_%s: %.1f (p95 %.1f) %s", r.test, r.metric, r.stats.median, r.stats.p95, r.unit);
+        else
+            sprintf(buf, "%s_%s: %.1f %s", r.test, r.metric, r.stats.median, r.unit);
+        displayText(buf, 10, y, TFT_WHITE, 1);
+        y += 15;
+    }
+
+    displayText("See Serial for full output", 10, 305, TFT_YELLOW, 1);
+
+    // Print to serial
+    Serial.println("\n===== TEST RESULTS =====");
+    for (size_t i = 0; i < benchResultCount(); i++)
+    {
+        const BenchResult &r = benchResult(i);
+        Serial.print(r.test);
+        Serial.print("_");
+        Serial.print(r.metric);
+        Serial.print(": ");
+        Serial.print(r.stats.median);
+        Serial.print(" ");
+        Serial.print(r.unit);
+        if (r.stats.n > 1)
+        {
+            Serial.print(" (n=");
+            Serial.print(r.stats.n);
+            Serial.print(", min ");
+            Serial.print(r.stats.min);
+            Serial.print(", p95 ");
+            Serial.print(r.stats.p95);
+            Serial.print(", p99 ");
+            Serial.print(r.stats.p99);
+            Serial.print(", stddev ");
+            Serial.print(r.stats.stddev);
+            Serial.print(")");
+        }
+        Serial.println();
+    }
+    Serial.println("========================\n");
+}
+
+// ============================================================================
+// SETUP AND MAIN LOOP
+// ============================================================================
+
+void setup()
 {
     Serial.begin(115200);
     Serial.println("\n\n===== Enhanced Sprite Test Firmware =====");
@@ -832,6 +3106,13 @@ void setup()
 
     displayText("Initializing...", 10, 10, TFT_CYAN, 2);
 
+    // Touch reports positions in the display rotation
+    TouchPins touchPins = {TOUCH_CLK, TOUCH_MOSI, TOUCH_MISO, TOUCH_CS, TOUCH_IRQ};
+    TouchCalibration touchCal = {TOUCH_MIN_X, TOUCH_MAX_X, TOUCH_MIN_Y, TOUCH_MAX_Y};
+    if (!touch.begin(touchPins, touchCal, SCREEN_WIDTH, SCREEN_HEIGHT))
+        Serial.println("Touch task failed to start");
+    touch.setRotation(3);
+
     // Initialize SD card
     displayText("SD Card...", 10, 40, TFT_WHITE);
     if (!SD.begin(SD_CS))
@@ -853,7 +3134,7 @@ void setup()
     
     bluegillBuffer = (uint16_t *)malloc(BLUEGILL_WIDTH * BLUEGILL_HEIGHT * 2);
     clankerBuffer = (uint16_t *)malloc(CLANKER_WIDTH * CLANKER_HEIGHT * 2);
-    // backgroundBuffer allocated on-demand in tests to save memory
+    // Larger assets come through the asset cache (budget set below)
 
     if (!bluegillBuffer || !clankerBuffer)
     {
@@ -869,12 +3150,20 @@ void setup()
     Serial.println(freeAfter);
     Serial.print("Used: ");
     Serial.println(freeBefore - freeAfter);
+
+    size_t assetBudget = freeAfter > ASSET_HEAP_RESERVE ? freeAfter - ASSET_HEAP_RESERVE : 0;
+    assets.begin(assetBudget, loadRGB565FromSD);
+    Serial.print("Asset cache budget: ");
+    Serial.println(assetBudget);
     
     displayText("Buffers OK", 10, 70, TFT_GREEN);
 
     displayText("Press RESET to start tests", 10, 120, TFT_YELLOW);
     delay(3000);
 
+    benchSetFormat(BENCH_OUTPUT);
+    benchPrintMeta("sprite_test_firmware");
+
     Serial.println("Starting tests...\n");
 }
 
@@ -913,12 +3202,60 @@ void loop()
         testB3_MemoryUsage();
         break;
     case 8:
-        testC1_SpriteFPS();
+        testB4_TransparentBlit();
         break;
     case 9:
-        testC2_BackgroundPlusSprites();
+        testB5_IndexedFormat();
         break;
     case 10:
+        testB6_AtlasLoading();
+        break;
+    case 11:
+        testB7_SpiClockSweep();
+        break;
+    case 12:
+        testB8_EntityUpdate();
+        break;
+    case 13:
+        testB9_CompressedAssets();
+        break;
+    case 14:
+        testB10_FlashAssets();
+        break;
+    case 15:
+        testB11_SpriteTransforms();
+        break;
+    case 16:
+        testB12_GlyphCache();
+        break;
+    case 17:
+        testC1_SpriteFPS();
+        break;
+    case 18:
+        testC3_DirtyRectangles();
+        break;
+    case 19:
+        testC2_BackgroundPlusSprites();
+        break;
+    case 20:
+        testC2_BandCompositorDMA();
+        break;
+    case 21:
+        testC2_AlphaBlend();
+        break;
+    case 22:
+        testC4_DualCorePipeline();
+        break;
+    case 23:
+        testC5_Broadphase();
+        break;
+    case 24:
+        testC6_HardwareScroll();
+        break;
+    case 25:
+        testC7_AnimatedSprites();
+        break;
+    case 26:
         displayResults();
         testsComplete = true;
         break;
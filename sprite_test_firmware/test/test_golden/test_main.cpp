@@ -0,0 +1,160 @@
+/*
+ * Golden-image regression for the A-series tests on the host
+ *
+ * A1-A5 are only ever checked by eye on the board, so colour order and byte
+ * swap regressions in the renderer go unnoticed until someone looks. Here
+ * each of them runs on the simulated panel, its final frame is dumped as a
+ * PPM (what the viewer would see, see hostSimDumpPPM()) and compared with
+ * the golden frame checked in under golden/, allowing each 8-bit channel to
+ * be off by GOLDEN_CHANNEL_TOLERANCE.
+ *
+ *   pio test -e native
+ *   CYD_UPDATE_GOLDEN=1 pio test -e native     (rewrite the goldens)
+ *
+ * A failing test leaves its frame beside the golden as NAME.actual.ppm.
+ * The SD card is the fixture card in sd/, not CYD_SD_ROOT, so the frames
+ * don't depend on what is on the developer's card. Paths are relative to
+ * the project directory, where pio runs the test program.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "HostSim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define GOLDEN_DIR "test/test_golden/golden"
+#define GOLDEN_SD_ROOT "test/test_golden/sd"
+
+// One LSB of a 5-bit channel is 8 or 9 in the dump: a rounding change in a
+// blend passes, a swapped or reordered channel doesn't
+#ifndef GOLDEN_CHANNEL_TOLERANCE
+#define GOLDEN_CHANNEL_TOLERANCE 9
+#endif
+
+void setup();
+void testA1_RGBOrder();
+void testA2_Inversion();
+void testA3_ByteSwap();
+void testA4_SDvsPNGColors();
+void testA5_PureColorPattern();
+
+struct PpmImage
+{
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> rgb;
+};
+
+static bool readPPM(const char *path, PpmImage &image)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+
+    int maxValue = 0;
+    bool ok = fscanf(f, "P6 %d %d %d", &image.width, &image.height, &maxValue) == 3 &&
+              maxValue == 255 && image.width > 0 && image.height > 0 && fgetc(f) != EOF;
+    if (ok)
+    {
+        image.rgb.resize((size_t)image.width * image.height * 3);
+        ok = fread(image.rgb.data(), 1, image.rgb.size(), f) == image.rgb.size();
+    }
+    fclose(f);
+    return ok;
+}
+
+// ============================================================================
+// COMPARISON
+// ============================================================================
+
+// Runs one test and checks the frame it leaves on the panel
+static void checkGolden(const char *name, void (*test)())
+{
+    test();
+
+    char goldenPath[256], actualPath[256];
+    snprintf(goldenPath, sizeof(goldenPath), "%s/%s.ppm", GOLDEN_DIR, name);
+    snprintf(actualPath, sizeof(actualPath), "%s/%s.actual.ppm", GOLDEN_DIR, name);
+
+    const char *update = getenv("CYD_UPDATE_GOLDEN");
+    if (update && *update && *update != '0')
+    {
+        TEST_ASSERT_TRUE_MESSAGE(hostSimDumpPPM(goldenPath), "Can't write golden frame");
+        printf("Updated %s\n", goldenPath);
+        return;
+    }
+
+    PpmImage golden, actual;
+    char msg[512];
+    snprintf(msg, sizeof(msg), "No golden frame %s (run with CYD_UPDATE_GOLDEN=1)", goldenPath);
+    TEST_ASSERT_TRUE_MESSAGE(readPPM(goldenPath, golden), msg);
+    TEST_ASSERT_TRUE_MESSAGE(hostSimDumpPPM(actualPath), "Can't write frame");
+    TEST_ASSERT_TRUE_MESSAGE(readPPM(actualPath, actual), "Can't read back frame");
+
+    snprintf(msg, sizeof(msg), "Frame is %dx%d, golden %dx%d",
+             actual.width, actual.height, golden.width, golden.height);
+    TEST_ASSERT_TRUE_MESSAGE(actual.width == golden.width && actual.height == golden.height, msg);
+
+    // Count pixels with any channel out of tolerance and note the first
+    int wrong = 0, firstX = -1, firstY = -1, maxDiff = 0;
+    for (size_t i = 0; i < actual.rgb.size(); i += 3)
+    {
+        int worst = 0;
+        for (int c = 0; c < 3; c++)
+            worst = max(worst, abs((int)actual.rgb[i + c] - (int)golden.rgb[i + c]));
+        maxDiff = max(maxDiff, worst);
+        if (worst <= GOLDEN_CHANNEL_TOLERANCE)
+            continue;
+        if (wrong++ == 0)
+        {
+            firstX = (int)(i / 3) % actual.width;
+            firstY = (int)(i / 3) / actual.width;
+        }
+    }
+
+    if (wrong == 0)
+    {
+        remove(actualPath);
+        return;
+    }
+    size_t first = ((size_t)firstY * actual.width + firstX) * 3;
+    snprintf(msg, sizeof(msg),
+             "%d pixels off by more than %d (max %d), first at (%d,%d): %02X%02X%02X, golden %02X%02X%02X; see %s",
+             wrong, GOLDEN_CHANNEL_TOLERANCE, maxDiff, firstX, firstY,
+             actual.rgb[first], actual.rgb[first + 1], actual.rgb[first + 2],
+             golden.rgb[first], golden.rgb[first + 1], golden.rgb[first + 2], actualPath);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void setUp() {}
+void tearDown() {}
+
+void test_A1_RGBOrder() { checkGolden("A1_RGBOrder", testA1_RGBOrder); }
+void test_A2_Inversion() { checkGolden("A2_Inversion", testA2_Inversion); }
+void test_A3_ByteSwap() { checkGolden("A3_ByteSwap", testA3_ByteSwap); }
+void test_A4_SDvsPNGColors() { checkGolden("A4_SDvsPNGColors", testA4_SDvsPNGColors); }
+void test_A5_PureColorPattern() { checkGolden("A5_PureColorPattern", testA5_PureColorPattern); }
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    setenv("CYD_SD_ROOT", GOLDEN_SD_ROOT, 1);
+    setup();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_A1_RGBOrder);
+    RUN_TEST(test_A2_Inversion);
+    RUN_TEST(test_A3_ByteSwap);
+    RUN_TEST(test_A4_SDvsPNGColors);
+    RUN_TEST(test_A5_PureColorPattern);
+    return UNITY_END();
+}
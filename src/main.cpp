@@ -1,7 +1,8 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <TFT_eSPI.h>
-#include <XPT2046_Touchscreen.h>
+#include <TouchInput.h>
+#include <SpiSweep.h>
 #include <WiFi.h>
 #include <SD.h>
 #include <math.h>
@@ -23,8 +24,7 @@
 
 // --- Globals ---
 TFT_eSPI tft = TFT_eSPI();
-SPIClass touchSPI = SPIClass(VSPI);
-XPT2046_Touchscreen touch(XPT2046_CS, XPT2046_IRQ);
+TouchInput touch;
 
 // Test results
 bool colorInvertNeeded = true;  // Will be determined by color test
@@ -116,30 +116,17 @@ void printConfig()
 
 void waitForTouch()
 {
-    while (!touch.touched())
-    {
-        delay(10);
-    }
-    while (touch.touched())
-    {
-        delay(10);
-    }
+    TouchEvent tap;
+    touch.flush();
+    touch.waitForTap(tap, 0);
 }
 
 // Wait for touch with timeout, returns true if touched
 bool waitForTouchTimeout(int timeoutMs)
 {
-    unsigned long start = millis();
-    while (!touch.touched())
-    {
-        if (millis() - start > timeoutMs) return false;
-        delay(10);
-    }
-    while (touch.touched())
-    {
-        delay(10);
-    }
-    return true;
+    TouchEvent tap;
+    touch.flush();
+    return touch.waitForTap(tap, timeoutMs);
 }
 
 // ============================================================================
@@ -223,25 +210,12 @@ void testColorInversion()
     // Wait for touch and determine which side
     while (true)
     {
-        if (touch.touched())
+        // A tap is complete on release; x is already calibrated
+        TouchEvent p;
+        if (touch.poll(p) && p.type == TOUCH_UP)
         {
-            TS_Point p = touch.getPoint();
-            Serial.printf("Touch at raw X=%d\n", p.x);
-
-            // Map touch to screen using calibration if available
-            int mappedX;
-            if (touchMinX != 0 && touchMaxX != 0)
-            {
-                // Use calibration data
-                mappedX = map(p.x, touchMinX, touchMaxX, 0, 240);
-            }
-            else
-            {
-                // Fallback to rough mapping if not calibrated yet
-                mappedX = map(p.x, 200, 3800, 0, 240);
-            }
-
-            while (touch.touched()) delay(10);  // Wait for release
+            Serial.printf("Touch at raw X=%d\n", p.rawX);
+            int mappedX = p.x;
 
             if (mappedX < 120)
             {
@@ -326,22 +300,10 @@ void detectDriver()
     // Wait for touch
     while (true)
     {
-        if (touch.touched())
+        TouchEvent p;
+        if (touch.poll(p) && p.type == TOUCH_UP)
         {
-            TS_Point p = touch.getPoint();
-            
-            // Map touch to screen using calibration if available
-            int mappedX;
-            if (touchMinX != 0 && touchMaxX != 0)
-            {
-                mappedX = map(p.x, touchMinX, touchMaxX, 0, 240);
-            }
-            else
-            {
-                mappedX = map(p.x, 200, 3800, 0, 240);
-            }
-
-            while (touch.touched()) delay(10);
+            int mappedX = p.x;
 
             if (mappedX < 120)
             {
@@ -486,81 +448,68 @@ void testMemory()
 
 // ============================================================================
 // SPI SPEED TEST
-// Tests various SPI frequencies to find maximum stable speed
+// Reclocks the display bus step by step and verifies each clock by reading
+// a test pattern back (lib/SpiSweep)
 // ============================================================================
+#define SPI_TEST_BAND_HEIGHT 40
+
 void testSPISpeed()
 {
     Serial.println("\n=== SPI SPEED TEST ===");
     
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextDatum(TC_DATUM);
-    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-    tft.drawString("SPI SPEED TEST", 120, 10);
-    
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setTextDatum(TL_DATUM);
-    tft.setCursor(10, 40);
-    tft.println("Testing SPI frequencies...");
-    tft.println("");
-    
-    // Test frequencies (Hz)
+    // Test frequencies (Hz); the ESP32 runs each at 80 MHz / n, at or below it
     uint32_t testFreqs[] = {10000000, 20000000, 27000000, 40000000, 55000000, 80000000};
     const char* freqNames[] = {"10 MHz", "20 MHz", "27 MHz", "40 MHz", "55 MHz", "80 MHz"};
     int numTests = 6;
     
     maxStableSPI = 10000000;  // Start with safe default
-    
+
+    // Pattern band at the bottom, clear of the result list
+    uint16_t *buffer = (uint16_t *)malloc(240 * SPI_TEST_BAND_HEIGHT * 2);
+    if (!buffer)
+    {
+        Serial.println("Not enough memory for the read-back buffer, keeping 10 MHz");
+        return;
+    }
+
+    SpiSweepStep steps[6];
+    int numRun = 0;
     for (int i = 0; i < numTests; i++)
     {
-        uint32_t freq = testFreqs[i];
-        
         Serial.printf("Testing %s...", freqNames[i]);
-        tft.setTextColor(TFT_CYAN, TFT_BLACK);
-        tft.printf("Testing %s...", freqNames[i]);
-        
-        // Temporarily set new SPI frequency
-        // Note: TFT_eSPI doesn't expose direct SPI frequency control easily,
-        // so we'll use a visual test approach
-        
-        // Draw test pattern
-        bool testPassed = true;
-        
-        // Simple gradient test - if display corruption occurs, it likely won't render
-        for (int x = 0; x < 240; x += 20)
-        {
-            uint16_t color = tft.color565(x, x, x);
-            tft.fillRect(x, 200, 20, 40, color);
-        }
-        
-        delay(300);  // Let display settle
-        
-        // For now, we'll mark tests as passed up to known safe limits
-        // ILI9341: typically 40MHz max
-        // ST7789: typically 80MHz max
-        if (driverType == "ILI9341")
-        {
-            testPassed = (freq <= 55000000);
-        }
-        else  // ST7789
+
+        // Each step repaints the whole screen (fill throughput), so the
+        // list is redrawn after it
+        bool testPassed = spiSweepStep(tft, testFreqs[i], 0, 320 - SPI_TEST_BAND_HEIGHT, 240,
+                                       SPI_TEST_BAND_HEIGHT, buffer, steps[i]);
+        numRun = i + 1;
+
+        tft.setTextDatum(TC_DATUM);
+        tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+        tft.drawString("SPI SPEED TEST", 120, 10);
+        tft.setTextDatum(TL_DATUM);
+        tft.setCursor(10, 40);
+        for (int j = 0; j < numRun; j++)
         {
-            testPassed = (freq <= 80000000);
+            tft.setTextColor(TFT_CYAN, TFT_BLACK);
+            tft.printf("%s: %.1f MB/s", freqNames[j], steps[j].fillMBps);
+            tft.setTextColor(steps[j].passed ? TFT_GREEN : TFT_RED, TFT_BLACK);
+            tft.println(steps[j].passed ? " PASS" : " FAIL");
         }
-        
+
         if (testPassed)
         {
-            maxStableSPI = freq;
-            tft.setTextColor(TFT_GREEN, TFT_BLACK);
-            tft.println(" PASS");
-            Serial.println(" PASS");
+            maxStableSPI = testFreqs[i];
+            Serial.printf(" PASS (%.2f MB/s fill)\n", steps[i].fillMBps);
         }
         else
         {
-            tft.setTextColor(TFT_RED, TFT_BLACK);
-            tft.println(" SKIP");
-            Serial.println(" SKIP (exceeds driver limit)");
+            Serial.printf(" FAIL (CRC %08X != %08X, %u bad pixels)\n",
+                          steps[i].readCrc, steps[i].writeCrc, steps[i].badPixels);
             break;  // Stop testing higher frequencies
         }
     }
+    free(buffer);
     
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.println("");
@@ -572,18 +521,20 @@ void testSPISpeed()
     delay(2000);
 }
 
-TS_Point getTouchPoint()
+TouchEvent getTouchPoint()
 {
-    while (!touch.touched())
-    {
-        delay(10);
-    }
-    TS_Point p = touch.getPoint();
-    while (touch.touched())
-    {
-        delay(10);
-    }
-    return p;
+    TouchEvent tap;
+    touch.flush();
+    touch.waitForTap(tap, 0);
+    return tap;
+}
+
+// Raw reading at screen position edge, extrapolated from the readings of
+// taps at positions a and b
+static uint16_t touchEdge(int rawA, int rawB, int a, int b, int edge)
+{
+    int raw = rawA + (rawB - rawA) * (edge - a) / (b - a);
+    return constrain(raw, 0, 4095);
 }
 
 void calibrateTouch()
@@ -601,9 +552,9 @@ void calibrateTouch()
     tft.setTextDatum(TL_DATUM);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.drawString("TOUCH HERE", 30, 20);
-    TS_Point p1 = getTouchPoint();
+    TouchEvent p1 = getTouchPoint();
     
-    Serial.printf("Top-left tap: X=%d, Y=%d, Z=%d\n", p1.x, p1.y, p1.z);
+    Serial.printf("Top-left tap: X=%d, Y=%d, Z=%d\n", p1.rawX, p1.rawY, p1.z);
 
     // Bottom Right
     tft.fillScreen(TFT_BLACK);
@@ -611,28 +562,17 @@ void calibrateTouch()
     tft.drawCircle(230, 310, 8, TFT_WHITE);
     tft.setTextDatum(TL_DATUM);
     tft.drawString("TOUCH HERE", 150, 300);
-    TS_Point p2 = getTouchPoint();
+    TouchEvent p2 = getTouchPoint();
     
-    Serial.printf("Bottom-right tap: X=%d, Y=%d, Z=%d\n", p2.x, p2.y, p2.z);
+    Serial.printf("Bottom-right tap: X=%d, Y=%d, Z=%d\n", p2.rawX, p2.rawY, p2.z);
 
-    touchMinX = p1.x;
-    touchMinY = p1.y;
-    touchMaxX = p2.x;
-    touchMaxY = p2.y;
-    
-    // Auto-correct if min/max are swapped
-    if (touchMinX > touchMaxX) {
-        uint16_t temp = touchMinX;
-        touchMinX = touchMaxX;
-        touchMaxX = temp;
-        Serial.println("Auto-swapped X min/max");
-    }
-    if (touchMinY > touchMaxY) {
-        uint16_t temp = touchMinY;
-        touchMinY = touchMaxY;
-        touchMaxY = temp;
-        Serial.println("Auto-swapped Y min/max");
-    }
+    // Extend the two targets out to the screen edges. Min/max stay in tap
+    // order (min may be larger): that is how the axis direction is kept.
+    touchMinX = touchEdge(p1.rawX, p2.rawX, 10, 230, 0);
+    touchMaxX = touchEdge(p1.rawX, p2.rawX, 10, 230, 239);
+    touchMinY = touchEdge(p1.rawY, p2.rawY, 10, 310, 0);
+    touchMaxY = touchEdge(p1.rawY, p2.rawY, 10, 310, 319);
+    touch.setCalibration({touchMinX, touchMaxX, touchMinY, touchMaxY});
 
     Serial.printf("Calibration complete: X=%d to %d, Y=%d to %d\n", 
                   touchMinX, touchMaxX, touchMinY, touchMaxY);
@@ -720,11 +660,11 @@ void setup()
     Serial.println("========================================");
     Serial.println("Starting initialization...\n");
 
-    // Init Touch SPI FIRST (before display - prevents ghosting)
+    // Init touch FIRST (before display - prevents ghosting). The sampling
+    // task bit-bangs the XPT2046 pins, leaving VSPI to the SD card.
     Serial.println("Initializing touch...");
-    touchSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
-    touch.begin(touchSPI);
-    // Don't set rotation - XPT2046 library handles it internally
+    TouchPins touchPins = {XPT2046_CLK, XPT2046_MOSI, XPT2046_MISO, XPT2046_CS, XPT2046_IRQ};
+    touch.begin(touchPins, {touchMinX, touchMaxX, touchMinY, touchMaxY}, 240, 320);
 
     // --- DISPLAY INIT (Robust) ---
     Serial.println("Initializing display...");
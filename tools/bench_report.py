@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Benchmark Log Report
+Turns the BENCH lines that sprite_test_firmware prints on Serial (see
+sprite_test_firmware/src/Bench.h) into tables, so runs on different boards or
+firmware builds can be compared
+
+Accepted lines, mixed freely with other serial output which is ignored:
+    BENCH_META,firmware=...,build=...,cpu_mhz=...,spi_hz=...,heap=...
+    BENCH,<test>,<metric>,<unit>,<n>,<min>,<median>,<p95>,<p99>,<mean>,<stddev>
+    {"bench_meta":{...}}
+    {"bench":"<test>","metric":"<metric>","unit":"<unit>","n":...,"min":...}
+
+One log prints every statistic per metric. Several logs print one statistic
+(--stat, default median) side by side, with the change against the first log.
+
+Example:
+    pio device monitor | tee cyd_a.log
+    python bench_report.py cyd_a.log cyd_b.log --stat p95
+"""
+
+import json
+import sys
+import os
+
+STATS = ['n', 'min', 'median', 'p95', 'p99', 'mean', 'stddev']
+
+def parse_log(path):
+    """
+    Read one serial log
+
+    Returns (meta dict, ordered dict of (test, metric) -> result dict)
+    """
+    meta = {}
+    results = {}
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('BENCH_META,'):
+                for field in line.split(',')[1:]:
+                    key, _, value = field.partition('=')
+                    meta[key] = value
+            elif line.startswith('BENCH,') and not line.startswith('BENCH,test,'):
+                fields = line.split(',')
+                if len(fields) != 11:
+                    continue
+                try:
+                    values = [float(v) for v in fields[4:]]
+                except ValueError:
+                    continue
+                result = {'unit': fields[3]}
+                result.update(zip(STATS, values))
+                results[(fields[1], fields[2])] = result
+            elif line.startswith('{'):
+                try:
+                    obj = json.loads(line)
+                except ValueError:
+                    continue
+                if 'bench_meta' in obj:
+                    meta.update({k: str(v) for k, v in obj['bench_meta'].items()})
+                elif 'bench' in obj:
+                    result = {'unit': obj.get('unit', '')}
+                    result.update({s: float(obj.get(s, 0)) for s in STATS})
+                    results[(obj['bench'], obj.get('metric', ''))] = result
+    return meta, results
+
+def label_for(path, meta):
+    """Column heading for a log: file name plus the build it came from"""
+    name = os.path.splitext(os.path.basename(path))[0]
+    if 'build' in meta:
+        return f"{name} ({meta['build']})"
+    return name
+
+def format_value(value):
+    if value == int(value) and abs(value) < 1e9:
+        return str(int(value))
+    return f"{value:.1f}"
+
+def print_table(headers, rows):
+    """Plain text table, left-aligned first column, the rest right-aligned"""
+    widths = [max(len(str(row[i])) for row in [headers] + rows) for i in range(len(headers))]
+    def line(cells):
+        out = [str(cells[0]).ljust(widths[0])]
+        out += [str(c).rjust(w) for c, w in zip(cells[1:], widths[1:])]
+        return '  '.join(out)
+    print(line(headers))
+    print('  '.join('-' * w for w in widths))
+    for row in rows:
+        print(line(row))
+
+def report_single(path, meta, results):
+    """Every statistic for every metric in one log"""
+    print(f"{label_for(path, meta)}")
+    for key in ('firmware', 'cpu_mhz', 'spi_hz', 'heap'):
+        if key in meta:
+            print(f"  {key}: {meta[key]}")
+    print()
+
+    rows = []
+    for (test, metric), r in results.items():
+        rows.append([f"{test}_{metric}", r['unit']] + [format_value(r[s]) for s in STATS])
+    print_table(['metric', 'unit'] + STATS, rows)
+
+def report_compare(logs, stat):
+    """One statistic per metric, one column per log, with change vs the first"""
+    keys = []
+    for _, _, results in logs:
+        for key in results:
+            if key not in keys:
+                keys.append(key)
+
+    headers = ['metric', 'unit']
+    for i, (path, meta, _) in enumerate(logs):
+        headers.append(label_for(path, meta))
+        if i > 0:
+            headers.append('change')
+
+    rows = []
+    for key in keys:
+        unit = next(r[key]['unit'] for _, _, r in logs if key in r)
+        row = [f"{key[0]}_{key[1]}", unit]
+        base = logs[0][2].get(key)
+        for i, (_, _, results) in enumerate(logs):
+            r = results.get(key)
+            row.append(format_value(r[stat]) if r else '-')
+            if i > 0:
+                if r and base and base[stat]:
+                    row.append(f"{(r[stat] - base[stat]) * 100 / base[stat]:+.1f}%")
+                else:
+                    row.append('-')
+        rows.append(row)
+
+    print(f"Statistic: {stat}\n")
+    print_table(headers, rows)
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='Benchmark Log Report')
+    parser.add_argument('logs', nargs='+', help='Serial logs containing BENCH lines (CSV or JSON)')
+    parser.add_argument('--stat', choices=STATS, default='median', help='Statistic to compare across logs (default median)')
+    parser.add_argument('--filter', help='Only metrics whose name starts with this (e.g. C1)')
+
+    args = parser.parse_args()
+
+    logs = []
+    for path in args.logs:
+        if not os.path.exists(path):
+            print(f"Error: File not found: {path}")
+            sys.exit(1)
+        meta, results = parse_log(path)
+        if args.filter:
+            results = {k: v for k, v in results.items() if f"{k[0]}_{k[1]}".startswith(args.filter)}
+        if not results:
+            print(f"Warning: no BENCH lines in {path}")
+        logs.append((path, meta, results))
+
+    if len(logs) == 1:
+        report_single(*logs[0])
+    else:
+        report_compare(logs, args.stat)
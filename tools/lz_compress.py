@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+LZ Image Compressor
+Compresses converted .rgb565 and .idx8 images into the LZ format decoded by
+LzReader in sprite_test_firmware/src/LzImage.cpp (.lz565 and .lzi8)
+
+File layout (all values little-endian):
+    'LZI1'              4-byte magic
+    uint8  format       0 = RGB565, 1 = 8-bit indexed
+    uint8  windowBits   decoder window is 2^windowBits pixels (8..12)
+    uint16 width
+    uint16 height
+    uint16 colors       palette entries (0 for RGB565)
+    colors x uint16     palette, as in the .idx8 file
+    LZSS stream of width*height pixels
+
+The stream is groups of up to eight items behind a flag byte, lowest bit
+first: a set bit is a literal pixel (2 bytes RGB565 or 1 index byte), a
+clear bit a back reference, a uint16 token holding distance - 1 in pixels in
+the low windowBits and length - MIN_MATCH above. When the length field is
+all ones, one more byte follows and is added to the length.
+
+The window is what the ESP32 keeps in RAM while decoding: 4 KB for RGB565
+at the default 11 bits. Smaller windows save RAM and compress less.
+"""
+
+import struct
+import sys
+import os
+
+LZ_MAGIC = b'LZI1'
+FORMAT_RGB565 = 0
+FORMAT_INDEXED = 1
+
+# Chains followed per position when looking for the longest match
+MAX_CHAIN = 64
+
+def raw_size(path, spec):
+    """Width and height of a raw .rgb565 file"""
+    if spec:
+        w, h = (int(v) for v in spec.lower().split('x'))
+        return w, h
+    png_path = os.path.splitext(path)[0] + '.png'
+    if os.path.exists(png_path):
+        from PIL import Image
+        return Image.open(png_path).size
+    raise ValueError(f"{path}: give the size as {path}:WxH")
+
+def read_image(arg):
+    """Returns (format, width, height, palette, pixel units) for one input"""
+    path, spec = arg, ''
+    if not os.path.exists(arg) and ':' in arg:
+        path, spec = arg.rsplit(':', 1)
+    ext = os.path.splitext(path)[1]
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if ext == '.rgb565':
+        w, h = raw_size(path, spec)
+        if len(data) != w * h * 2:
+            raise ValueError(f"{path}: {len(data)} bytes is not {w}x{h} RGB565")
+        return path, FORMAT_RGB565, w, h, [], list(struct.unpack(f'<{w * h}H', data))
+    if ext == '.idx8' and data[:4] == b'IDX8':
+        w, h, colors = struct.unpack('<HHH', data[4:10])
+        palette = list(struct.unpack(f'<{colors}H', data[10:10 + colors * 2]))
+        return path, FORMAT_INDEXED, w, h, palette, list(data[10 + colors * 2:])
+    raise ValueError(f"{path}: unsupported image file")
+
+def compress(units, unit_bytes, window_bits):
+    """Greedy LZSS over pixel units with hash chains"""
+    min_match = 2 if unit_bytes == 2 else 3
+    window = 1 << window_bits
+    length_full = 0xFFFF >> window_bits
+    max_match = min_match + length_full + 255
+    literal_fmt = '<H' if unit_bytes == 2 else '<B'
+
+    out = bytearray()
+    heads = {}
+    prev = [0] * len(units)
+    items = []
+
+    def insert(i):
+        if i + min_match <= len(units):
+            key = tuple(units[i:i + min_match])
+            prev[i] = heads.get(key, -1)
+            heads[key] = i
+
+    def flush():
+        flags = 0
+        for n, (literal, _) in enumerate(items):
+            if literal:
+                flags |= 1 << n
+        out.append(flags)
+        for _, payload in items:
+            out.extend(payload)
+        items.clear()
+
+    i = 0
+    while i < len(units):
+        best_len, best_dist = 0, 0
+        if i + min_match <= len(units):
+            candidate = heads.get(tuple(units[i:i + min_match]), -1)
+            limit = min(max_match, len(units) - i)
+            chain = 0
+            while candidate >= 0 and i - candidate <= window and chain < MAX_CHAIN:
+                n = 0
+                while n < limit and units[candidate + n] == units[i + n]:
+                    n += 1
+                if n > best_len:
+                    best_len, best_dist = n, i - candidate
+                    if n == limit:
+                        break
+                candidate = prev[candidate]
+                chain += 1
+
+        if best_len >= min_match:
+            field = min(best_len - min_match, length_full)
+            payload = struct.pack('<H', (best_dist - 1) | (field << window_bits))
+            if field == length_full:
+                payload += bytes([best_len - min_match - length_full])
+            items.append((False, payload))
+            for j in range(i, i + best_len):
+                insert(j)
+            i += best_len
+        else:
+            items.append((True, struct.pack(literal_fmt, units[i])))
+            insert(i)
+            i += 1
+
+        if len(items) == 8:
+            flush()
+    if items:
+        flush()
+    return bytes(out)
+
+def lz_compress(arg, output_path=None, window_bits=11):
+    """
+    Compress an image to the LZ format
+
+    Args:
+        arg: Input .rgb565[:WxH] or .idx8 file
+        output_path: Path to output file (.lz565 or .lzi8 next to the input)
+        window_bits: Decoder window, 2^window_bits pixels
+    """
+    try:
+        path, fmt, w, h, palette, units = read_image(arg)
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    if output_path is None:
+        ext = '.lzi8' if fmt == FORMAT_INDEXED else '.lz565'
+        output_path = os.path.splitext(path)[0] + ext
+
+    unit_bytes = 1 if fmt == FORMAT_INDEXED else 2
+    stream = compress(units, unit_bytes, window_bits)
+    with open(output_path, 'wb') as f:
+        f.write(LZ_MAGIC)
+        f.write(struct.pack('<BBHHH', fmt, window_bits, w, h, len(palette)))
+        f.write(struct.pack(f'<{len(palette)}H', *palette))
+        f.write(stream)
+
+    raw_bytes = w * h * 2
+    size = 12 + len(palette) * 2 + len(stream)
+    window_bytes = (1 << window_bits) * unit_bytes
+    print(f"Compressed {path}: {w}x{h} {'indexed' if unit_bytes == 1 else 'RGB565'}")
+    print(f"  {size} bytes ({size * 100 // raw_bytes}% of raw RGB565), {window_bytes} byte window")
+    print(f"  ✓ Saved to {output_path}")
+    return True
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='LZ Image Compressor')
+    parser.add_argument('inputs', nargs='+', help='Image files: .rgb565[:WxH], .idx8')
+    parser.add_argument('--output', '-o', help='Output filename (single input only)')
+    parser.add_argument('--window-bits', type=int, default=11, choices=range(8, 13),
+                        help='Decoder window, 2^N pixels (default 11)')
+
+    args = parser.parse_args()
+
+    if args.output and len(args.inputs) > 1:
+        parser.error('--output takes a single input')
+    ok = all([lz_compress(arg, args.output, args.window_bits) for arg in args.inputs])
+    if not ok:
+        sys.exit(1)
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Animation Sheet Builder
+Stacks equally sized frames top to bottom into one raw RGB565 sheet, the
+layout AnimSheet in sprite_test_firmware/src/Animation.cpp expects. Pack
+the sheet into the atlas with pack_atlas.py as file.rgb565:Wx(H*frames).
+
+Frames are PNGs (transparency composited onto black, as png_to_rgb565.py
+does) or converted .rgb565 files given as file.rgb565:WxH. With --wiggle N
+a single frame is turned into an N-frame swim cycle instead, each column
+shifted up or down along a travelling sine wave that grows towards the
+tail, for testing animation before real frames are drawn.
+"""
+
+import math
+import struct
+import sys
+import os
+
+def pack565(r, g, b, bgr=False):
+    """Pack 8-bit channels as RGB565 (or BGR565)"""
+    r5 = (r >> 3) & 0x1F
+    g6 = (g >> 2) & 0x3F
+    b5 = (b >> 3) & 0x1F
+    if bgr:
+        return (b5 << 11) | (g6 << 5) | r5
+    return (r5 << 11) | (g6 << 5) | b5
+
+def read_frame(arg, bgr=False):
+    """Returns (width, height, pixels) for one frame file"""
+    path, spec = arg, ''
+    if not os.path.exists(arg) and ':' in arg:
+        path, spec = arg.rsplit(':', 1)
+    ext = os.path.splitext(path)[1].lower()
+
+    if ext == '.png':
+        from PIL import Image
+        img_orig = Image.open(path)
+        if img_orig.mode in ('RGBA', 'LA') or (img_orig.mode == 'P' and 'transparency' in img_orig.info):
+            img = Image.new('RGB', img_orig.size, (0, 0, 0))
+            img_orig = img_orig.convert('RGBA')
+            img.paste(img_orig, mask=img_orig.split()[3])
+        else:
+            img = img_orig.convert('RGB')
+        w, h = img.size
+        return w, h, [pack565(*img.getpixel((x, y)), bgr) for y in range(h) for x in range(w)]
+    if ext == '.rgb565':
+        if not spec:
+            raise ValueError(f"{path}: give the size as {path}:WxH")
+        w, h = (int(v) for v in spec.lower().split('x'))
+        with open(path, 'rb') as f:
+            data = f.read()
+        if len(data) != w * h * 2:
+            raise ValueError(f"{path}: {len(data)} bytes is not {w}x{h} RGB565")
+        return w, h, list(struct.unpack(f'<{w * h}H', data))
+    raise ValueError(f"{path}: unsupported frame file")
+
+def wiggle_frames(w, h, pixels, count, amplitude=2.0):
+    """A swim cycle from one frame: columns shifted up and down along a wave"""
+    frames = []
+    for f in range(count):
+        phase = 2 * math.pi * f / count
+        out = [0] * (w * h)
+        for x in range(w):
+            # The head (right) stays put, the tail swings
+            weight = (w - 1 - x) / max(w - 1, 1)
+            dy = round(amplitude * weight * math.sin(phase + x * 2 * math.pi / w))
+            for y in range(h):
+                sy = y - dy
+                if 0 <= sy < h:
+                    out[y * w + x] = pixels[sy * w + x]
+        frames.append(out)
+    return frames
+
+def make_sheet(inputs, output_path, wiggle=0, bgr=False):
+    """
+    Build a sheet of stacked frames
+
+    Args:
+        inputs: Frame files (.png, .rgb565:WxH), in order
+        output_path: Path to output .rgb565 sheet
+        wiggle: If set, make this many frames from the single input
+        bgr: If True, pack PNG pixels as BGR565 instead of RGB565
+    """
+    try:
+        frames = [read_frame(arg, bgr) for arg in inputs]
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    w, h = frames[0][0], frames[0][1]
+    if any((fw, fh) != (w, h) for fw, fh, _ in frames):
+        print("Error: frames differ in size")
+        return False
+    pixels = [p for _, _, p in frames]
+    if wiggle:
+        if len(frames) != 1:
+            print("Error: --wiggle takes a single frame")
+            return False
+        pixels = wiggle_frames(w, h, pixels[0], wiggle)
+
+    with open(output_path, 'wb') as f:
+        for frame in pixels:
+            f.write(struct.pack(f'<{w * h}H', *frame))
+
+    print(f"  {len(pixels)} frames of {w}x{h}")
+    print(f"  ✓ Saved to {output_path}, pack as {os.path.basename(output_path)}:{w}x{h * len(pixels)}")
+    return True
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='Animation Sheet Builder')
+    parser.add_argument('output', help='Output .rgb565 sheet')
+    parser.add_argument('inputs', nargs='+', help='Frame files: .png, .rgb565:WxH')
+    parser.add_argument('--wiggle', type=int, default=0, help='Make an N-frame swim cycle from one frame')
+    parser.add_argument('--bgr', action='store_true', help='Use BGR565 bit order for PNGs')
+
+    args = parser.parse_args()
+
+    if not make_sheet(args.inputs, args.output, wiggle=args.wiggle, bgr=args.bgr):
+        sys.exit(1)
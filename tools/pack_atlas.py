@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+Sprite Atlas Packer
+Packs converted sprite files into one .atlas file read by SpriteAtlas in
+sprite_test_firmware/src/SpriteAtlas.cpp, so the firmware opens a single file
+and seeks to each sprite instead of paying SD.open for every asset
+
+File layout (all values little-endian):
+    'ATL1'              4-byte magic
+    uint16 count
+    uint16 reserved     0
+    count x entry (20 bytes):
+        uint32 hash     FNV-1a of the sprite name
+        uint32 offset   from the start of the file, 4-byte aligned
+        uint32 size     payload bytes
+        uint16 width
+        uint16 height
+        uint8  format   0 = raw RGB565, 1 = .rle565, 2 = .idx8
+        3 bytes padding
+    payloads
+
+Sprites are looked up by name and format, the name being the file name
+without extension (e.g. fish_bluegill_32x32), so one atlas can hold the raw
+and RLE versions of a sprite. Raw .rgb565 files carry no size, so give it as
+file.rgb565:WxH or keep the source PNG next to it.
+"""
+
+import struct
+import sys
+import os
+
+ATLAS_MAGIC = b'ATL1'
+ENTRY_FORMAT = '<IIIHHB3x'
+ENTRY_SIZE = struct.calcsize(ENTRY_FORMAT)
+
+FORMAT_RGB565 = 0
+FORMAT_RLE565 = 1
+FORMAT_IDX8 = 2
+
+def fnv1a(name):
+    """32-bit FNV-1a, matching SpriteAtlas::hashName()"""
+    h = 0x811C9DC5
+    for byte in name.encode('utf-8'):
+        h ^= byte
+        h = (h * 0x01000193) & 0xFFFFFFFF
+    return h
+
+def raw_size(path, spec):
+    """Width and height of a raw .rgb565 file"""
+    if spec:
+        w, h = (int(v) for v in spec.lower().split('x'))
+        return w, h
+    png_path = os.path.splitext(path)[0] + '.png'
+    if os.path.exists(png_path):
+        from PIL import Image
+        return Image.open(png_path).size
+    raise ValueError(f"{path}: give the size as {path}:WxH")
+
+def describe(arg):
+    """Returns (name, format, width, height, payload) for one input"""
+    path, spec = arg, ''
+    if not os.path.exists(arg) and ':' in arg:
+        path, spec = arg.rsplit(':', 1)
+    name, ext = os.path.splitext(os.path.basename(path))
+    with open(path, 'rb') as f:
+        payload = f.read()
+
+    if ext == '.rgb565':
+        w, h = raw_size(path, spec)
+        if len(payload) != w * h * 2:
+            raise ValueError(f"{path}: {len(payload)} bytes is not {w}x{h} RGB565")
+        return name, FORMAT_RGB565, w, h, payload
+    if ext == '.rle565' and payload[:4] == b'RLE1':
+        w, h = struct.unpack('<HH', payload[4:8])
+        return name, FORMAT_RLE565, w, h, payload
+    if ext == '.idx8' and payload[:4] == b'IDX8':
+        w, h = struct.unpack('<HH', payload[4:8])
+        return name, FORMAT_IDX8, w, h, payload
+    raise ValueError(f"{path}: unsupported sprite file")
+
+def pack_atlas(inputs, output_path):
+    """
+    Pack sprite files into an atlas
+
+    Args:
+        inputs: Sprite files (.rgb565[:WxH], .rle565, .idx8)
+        output_path: Path to output .atlas file
+    """
+    try:
+        sprites = [describe(arg) for arg in inputs]
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    keys = {}
+    for name, fmt, *_ in sprites:
+        key = (fnv1a(name), fmt)
+        if key in keys:
+            print(f"Error: '{name}' and '{keys[key]}' have the same hash and format")
+            return False
+        keys[key] = name
+
+    offset = 8 + ENTRY_SIZE * len(sprites)
+    entries = []
+    for name, fmt, w, h, payload in sprites:
+        offset = (offset + 3) & ~3
+        entries.append((fnv1a(name), offset, len(payload), w, h, fmt))
+        offset += len(payload)
+
+    with open(output_path, 'wb') as f:
+        f.write(ATLAS_MAGIC)
+        f.write(struct.pack('<HH', len(sprites), 0))
+        for entry in entries:
+            f.write(struct.pack(ENTRY_FORMAT, *entry))
+        for (name, fmt, w, h, payload), entry in zip(sprites, entries):
+            f.write(b'\0' * (entry[1] - f.tell()))
+            f.write(payload)
+            print(f"  {name}: {w}x{h} format {fmt}, {len(payload)} bytes at {entry[1]} (hash 0x{entry[0]:08X})")
+
+    print(f"  ✓ Saved {len(sprites)} sprites to {output_path} ({offset} bytes)")
+    return True
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='Sprite Atlas Packer')
+    parser.add_argument('output', help='Output .atlas file')
+    parser.add_argument('inputs', nargs='+', help='Sprite files: .rgb565[:WxH], .rle565, .idx8')
+
+    args = parser.parse_args()
+
+    if not pack_atlas(args.inputs, args.output):
+        sys.exit(1)
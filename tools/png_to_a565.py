@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+PNG to RGB565 + Alpha Converter
+Converts PNG sprites with alpha to the .a565 format blended by
+blendAlphaSprite() in sprite_test_firmware/src/AlphaBlend.cpp
+
+File layout (all values little-endian):
+    'A565'              4-byte magic
+    uint16 width
+    uint16 height
+    uint8  alphaBits    8 or 4
+    uint8  reserved     0
+    width*height x uint16   RGB565/BGR565 pixels, packed like the .rgb565 files
+    alpha plane, row by row:
+        8-bit: one byte per pixel
+        4-bit: (width + 1) / 2 bytes per row, two pixels per byte,
+               the left pixel in the low nibble
+
+Colours are kept as they are (not premultiplied or flattened onto black),
+so soft edges blend correctly over any background. Fully transparent
+pixels are stored as 0.
+
+Sprites cut out with a hard mask have no partly transparent pixels to
+blend. --feather R softens such an edge: the alpha is blurred with a
+Gaussian of radius R and only ever lowered, so the fade runs inwards over
+pixels whose colour is known.
+"""
+
+from PIL import Image, ImageChops, ImageFilter
+import struct
+import sys
+import os
+
+A565_MAGIC = b'A565'
+
+def pack565(r, g, b, bgr=False):
+    """Pack 8-bit channels as RGB565 (or BGR565)"""
+    r5 = (r >> 3) & 0x1F
+    g6 = (g >> 2) & 0x3F
+    b5 = (b >> 3) & 0x1F
+    if bgr:
+        return (b5 << 11) | (g6 << 5) | r5
+    return (r5 << 11) | (g6 << 5) | b5
+
+def encode_a565(width, height, rgba, alpha_bits=8, bgr=False):
+    """
+    Encode a row-major list of (r, g, b, a) tuples as an .a565 file
+
+    Returns the file contents
+    """
+    pixels = [pack565(r, g, b, bgr) if a else 0 for r, g, b, a in rgba]
+    if alpha_bits == 8:
+        plane = bytes(a for _, _, _, a in rgba)
+    else:
+        plane = bytearray()
+        for y in range(height):
+            row = [(rgba[y * width + x][3] * 15 + 127) // 255 for x in range(width)]
+            row.append(0)
+            plane.extend(row[x] | (row[x + 1] << 4) for x in range(0, width, 2))
+
+    return (A565_MAGIC + struct.pack('<HHBB', width, height, alpha_bits, 0) +
+            struct.pack(f'<{width * height}H', *pixels) + bytes(plane))
+
+def feather_alpha(img, radius):
+    """Soften the alpha edge of an RGBA image inwards by about radius pixels"""
+    alpha = img.getchannel('A')
+    blurred = alpha.filter(ImageFilter.GaussianBlur(radius))
+    img.putalpha(ImageChops.darker(alpha, blurred))
+    return img
+
+def png_to_a565(png_path, output_path=None, alpha_bits=8, bgr=False, feather=0):
+    """
+    Convert PNG to an RGB565 + alpha .a565 file
+
+    Args:
+        png_path: Path to input PNG file
+        output_path: Path to output .a565 file
+        alpha_bits: 8 or 4 bits of alpha per pixel
+        bgr: If True, pack as BGR565 instead of RGB565
+        feather: If set, soften the alpha edge by this radius in pixels
+    """
+    if not os.path.exists(png_path):
+        print(f"Error: File not found: {png_path}")
+        return False
+
+    if output_path is None:
+        output_path = os.path.splitext(png_path)[0] + '.a565'
+
+    try:
+        img = Image.open(png_path).convert('RGBA')
+        if feather:
+            img = feather_alpha(img, feather)
+        width, height = img.size
+        rgba = [img.getpixel((x, y)) for y in range(height) for x in range(width)]
+
+        print(f"Converting {png_path} to {'BGR565' if bgr else 'RGB565'} + {alpha_bits}-bit alpha")
+
+        data = encode_a565(width, height, rgba, alpha_bits, bgr)
+        with open(output_path, 'wb') as f:
+            f.write(data)
+
+        edge = sum(1 for p in rgba if 0 < p[3] < 255)
+        print(f"  {width}x{height}, {edge} partly transparent pixels")
+        print(f"  {len(data)} bytes ({len(data) * 100 // (width * height * 2)}% of raw RGB565)")
+        print(f"  ✓ Saved to {output_path}")
+        return True
+
+    except Exception as e:
+        print(f"Error converting {png_path}: {e}")
+        return False
+
+def batch_convert(directory, alpha_bits=8, bgr=False, feather=0):
+    """Convert all PNG files in a directory"""
+    converted = 0
+    for filename in os.listdir(directory):
+        if filename.lower().endswith('.png'):
+            if png_to_a565(os.path.join(directory, filename), alpha_bits=alpha_bits, bgr=bgr, feather=feather):
+                converted += 1
+    print(f"\nBatch conversion complete: {converted} files")
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='PNG to RGB565 + Alpha (.a565) Converter')
+    parser.add_argument('input', help='Input PNG file or directory')
+    parser.add_argument('output', nargs='?', help='Output filename (optional)')
+    parser.add_argument('--batch', action='store_true', help='Batch convert directory')
+    parser.add_argument('--alpha-bits', type=int, default=8, choices=(4, 8), help='Alpha bits per pixel (default 8)')
+    parser.add_argument('--bgr', action='store_true', help='Use BGR565 bit order')
+    parser.add_argument('--feather', type=float, default=0, help='Soften hard alpha edges by this radius in pixels')
+
+    args = parser.parse_args()
+
+    if args.batch:
+        batch_convert(args.input, alpha_bits=args.alpha_bits, bgr=args.bgr, feather=args.feather)
+    else:
+        png_to_a565(args.input, args.output, alpha_bits=args.alpha_bits, bgr=args.bgr, feather=args.feather)
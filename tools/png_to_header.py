@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+PNG to Flash Header Converter
+Embeds images in the firmware as a C++ header of const arrays, drawn
+straight from flash by pushFlashImage() in
+sprite_test_firmware/src/FlashImage.cpp
+
+Each image becomes
+    const uint16_t <name>_pixels[W * H] PROGMEM = {...};
+    constexpr FlashImage <name> = {W, H, <name>_pixels};
+with <name> the file name without extension. Pixels are RGB565 already in
+the panel's byte order (high byte first in memory), so they go out over SPI
+as stored, with no swap and no copy to RAM.
+
+Inputs are PNGs (transparency composited onto black, as png_to_rgb565.py
+does) or converted .rgb565 files; raw files carry no size, so give it as
+file.rgb565:WxH or keep the source PNG next to it.
+"""
+
+import struct
+import sys
+import os
+import re
+
+# Array values per line
+VALUES_PER_LINE = 12
+
+def pack565(r, g, b, bgr=False):
+    """Pack 8-bit channels as RGB565 (or BGR565)"""
+    r5 = (r >> 3) & 0x1F
+    g6 = (g >> 2) & 0x3F
+    b5 = (b >> 3) & 0x1F
+    if bgr:
+        return (b5 << 11) | (g6 << 5) | r5
+    return (r5 << 11) | (g6 << 5) | b5
+
+def png_pixels(path, bgr=False):
+    """Width, height and packed pixels of a PNG"""
+    from PIL import Image
+    img_orig = Image.open(path)
+    if img_orig.mode in ('RGBA', 'LA') or (img_orig.mode == 'P' and 'transparency' in img_orig.info):
+        img = Image.new('RGB', img_orig.size, (0, 0, 0))
+        img_orig = img_orig.convert('RGBA')
+        img.paste(img_orig, mask=img_orig.split()[3])
+    else:
+        img = img_orig.convert('RGB')
+    width, height = img.size
+    return width, height, [pack565(*img.getpixel((x, y)), bgr) for y in range(height) for x in range(width)]
+
+def raw_size(path, spec):
+    """Width and height of a raw .rgb565 file"""
+    if spec:
+        w, h = (int(v) for v in spec.lower().split('x'))
+        return w, h
+    png_path = os.path.splitext(path)[0] + '.png'
+    if os.path.exists(png_path):
+        from PIL import Image
+        return Image.open(png_path).size
+    raise ValueError(f"{path}: give the size as {path}:WxH")
+
+def read_image(arg, bgr=False):
+    """Returns (name, source file, width, height, pixels) for one input"""
+    path, spec = arg, ''
+    if not os.path.exists(arg) and ':' in arg:
+        path, spec = arg.rsplit(':', 1)
+    stem, ext = os.path.splitext(os.path.basename(path))
+    name = re.sub(r'\W', '_', stem)
+    if name[0].isdigit():
+        name = '_' + name
+
+    if ext.lower() == '.png':
+        w, h, pixels = png_pixels(path, bgr)
+        return name, os.path.basename(path), w, h, pixels
+    if ext == '.rgb565':
+        w, h = raw_size(path, spec)
+        with open(path, 'rb') as f:
+            data = f.read()
+        if len(data) != w * h * 2:
+            raise ValueError(f"{path}: {len(data)} bytes is not {w}x{h} RGB565")
+        return name, os.path.basename(path), w, h, list(struct.unpack(f'<{w * h}H', data))
+    raise ValueError(f"{path}: unsupported image file")
+
+def swap16(c):
+    """Panel byte order: the high byte first in memory"""
+    return ((c & 0xFF) << 8) | (c >> 8)
+
+def png_to_header(inputs, output_path, bgr=False):
+    """
+    Write images into one header
+
+    Args:
+        inputs: Image files (.png, .rgb565[:WxH])
+        output_path: Path to output .h file
+        bgr: If True, pack PNG pixels as BGR565 instead of RGB565
+    """
+    try:
+        images = [read_image(arg, bgr) for arg in inputs]
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        return False
+
+    names = [img[0] for img in images]
+    if len(set(names)) != len(names):
+        print("Error: two inputs have the same name")
+        return False
+
+    stem = re.sub(r'(?<=[a-z0-9])(?=[A-Z])', '_', os.path.basename(output_path))
+    guard = re.sub(r'\W', '_', stem).upper()
+    sources = ', '.join(img[1] for img in images)
+    total = 0
+    with open(output_path, 'w') as f:
+        f.write("/*\n")
+        f.write(" * Generated by tools/png_to_header.py - do not edit\n")
+        f.write(" *\n")
+        f.write(f" * Sources: {sources}\n")
+        f.write(" * RGB565 pixels in panel byte order, for pushFlashImage()\n")
+        f.write(" */\n\n")
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write('#include "FlashImage.h"\n')
+
+        for name, source, w, h, pixels in images:
+            values = [f"0x{swap16(c):04X}" for c in pixels]
+            f.write(f"\n// {source}: {w}x{h}\n")
+            f.write(f"const uint16_t {name}_pixels[{w} * {h}] PROGMEM = {{\n")
+            for i in range(0, len(values), VALUES_PER_LINE):
+                f.write("    " + ", ".join(values[i:i + VALUES_PER_LINE]) + ",\n")
+            f.write("};\n")
+            f.write(f"constexpr FlashImage {name} = {{{w}, {h}, {name}_pixels}};\n")
+            total += w * h * 2
+            print(f"  {name}: {w}x{h}, {w * h * 2} bytes")
+
+        f.write(f"\n#endif // {guard}\n")
+
+    print(f"  ✓ Saved {len(images)} images to {output_path} ({total} bytes of flash)")
+    return True
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='PNG to Flash Header Converter')
+    parser.add_argument('output', help='Output .h file')
+    parser.add_argument('inputs', nargs='+', help='Image files: .png, .rgb565[:WxH]')
+    parser.add_argument('--bgr', action='store_true', help='Use BGR565 bit order for PNGs')
+
+    args = parser.parse_args()
+
+    if not png_to_header(args.inputs, args.output, bgr=args.bgr):
+        sys.exit(1)
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+PNG to 8-bit Indexed Converter
+Converts PNG images to the palettized .idx8 format drawn by
+pushIndexedImage() in sprite_test_firmware/src/IndexedImage.cpp
+
+File layout (all values little-endian):
+    'IDX8'              4-byte magic
+    uint16 width
+    uint16 height
+    uint16 colors       palette entries used (1..256)
+    colors x uint16     palette, packed like the .rgb565 files
+    width*height bytes  palette index per pixel, row by row
+
+Transparency is composited onto black exactly like png_to_rgb565.py, so an
+.idx8 file draws the same picture as the .rgb565 file when the image has at
+most 256 distinct RGB565 colours. Larger images are reduced with PIL's
+median cut quantizer first.
+"""
+
+from PIL import Image
+import struct
+import sys
+import os
+
+IDX8_MAGIC = b'IDX8'
+
+def pack565(r, g, b, bgr=False):
+    """Pack 8-bit channels as RGB565 (or BGR565)"""
+    r5 = (r >> 3) & 0x1F
+    g6 = (g >> 2) & 0x3F
+    b5 = (b >> 3) & 0x1F
+    if bgr:
+        return (b5 << 11) | (g6 << 5) | r5
+    return (r5 << 11) | (g6 << 5) | b5
+
+def flatten(img_orig):
+    """Composite any alpha onto black, as png_to_rgb565.py does"""
+    if img_orig.mode in ('RGBA', 'LA') or (img_orig.mode == 'P' and 'transparency' in img_orig.info):
+        img = Image.new('RGB', img_orig.size, (0, 0, 0))
+        if img_orig.mode == 'P':
+            img_orig = img_orig.convert('RGBA')
+        img.paste(img_orig, mask=img_orig.split()[3] if img_orig.mode == 'RGBA' else None)
+        return img
+    return img_orig.convert('RGB')
+
+def packed_pixels(img, bgr=False):
+    width, height = img.size
+    return [pack565(*img.getpixel((x, y)), bgr) for y in range(height) for x in range(width)]
+
+def png_to_idx8(png_path, output_path=None, bgr=False):
+    """
+    Convert PNG to an 8-bit indexed .idx8 file
+
+    Args:
+        png_path: Path to input PNG file
+        output_path: Path to output .idx8 file
+        bgr: If True, pack the palette as BGR565 instead of RGB565
+    """
+    if not os.path.exists(png_path):
+        print(f"Error: File not found: {png_path}")
+        return False
+
+    if output_path is None:
+        output_path = os.path.splitext(png_path)[0] + '.idx8'
+
+    try:
+        img = flatten(Image.open(png_path))
+        width, height = img.size
+
+        print(f"Converting {png_path} to 8-bit indexed ({'BGR565' if bgr else 'RGB565'} palette)")
+
+        pixels = packed_pixels(img, bgr)
+        exact = len(set(pixels)) <= 256
+        if not exact:
+            print(f"  {len(set(pixels))} colours, quantizing to 256")
+            img = img.quantize(colors=256, method=Image.MEDIANCUT).convert('RGB')
+            pixels = packed_pixels(img, bgr)
+
+        palette = sorted(set(pixels))
+        index = {c: i for i, c in enumerate(palette)}
+
+        with open(output_path, 'wb') as f:
+            f.write(IDX8_MAGIC)
+            f.write(struct.pack('<HHH', width, height, len(palette)))
+            f.write(struct.pack(f'<{len(palette)}H', *palette))
+            f.write(bytes(index[c] for c in pixels))
+
+        raw_size = width * height * 2
+        idx_size = 10 + len(palette) * 2 + width * height
+        print(f"  {len(palette)} palette entries ({'exact' if exact else 'quantized'})")
+        print(f"  {idx_size} bytes ({idx_size * 100 // raw_size}% of raw RGB565)")
+        print(f"  ✓ Saved to {output_path}")
+        return True
+
+    except Exception as e:
+        print(f"Error converting {png_path}: {e}")
+        return False
+
+def batch_convert(directory, bgr=False):
+    """Convert all PNG files in a directory"""
+    converted = 0
+    for filename in os.listdir(directory):
+        if filename.lower().endswith('.png'):
+            if png_to_idx8(os.path.join(directory, filename), bgr=bgr):
+                converted += 1
+    print(f"\nBatch conversion complete: {converted} files")
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='PNG to 8-bit indexed (.idx8) Converter')
+    parser.add_argument('input', help='Input PNG file or directory')
+    parser.add_argument('output', nargs='?', help='Output filename (optional)')
+    parser.add_argument('--batch', action='store_true', help='Batch convert directory')
+    parser.add_argument('--bgr', action='store_true', help='Use BGR565 bit order')
+
+    args = parser.parse_args()
+
+    if args.batch:
+        batch_convert(args.input, bgr=args.bgr)
+    else:
+        png_to_idx8(args.input, args.output, bgr=args.bgr)
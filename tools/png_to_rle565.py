@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+PNG to Transparent RLE565 Converter
+Converts PNG sprites with alpha to the run-length .rle565 format drawn by
+drawRLESprite() in sprite_test_firmware/src/RLESprite.cpp
+
+File layout (all values little-endian):
+    'RLE1'              4-byte magic
+    uint16 width
+    uint16 height
+    uint32 words        number of uint16 words that follow
+    per row:
+        uint16 runs     opaque runs in this row
+        per run:
+            uint16 skip     transparent pixels before the run
+                            (counted from the end of the previous run)
+            uint16 length   opaque pixels in the run
+            length x uint16 RGB565/BGR565 pixels
+
+Transparency comes from the alpha channel, not a colour key, so genuinely
+black pixels stay opaque and edges are not pre-blended onto black.
+"""
+
+from PIL import Image
+import struct
+import sys
+import os
+
+RLE_MAGIC = b'RLE1'
+
+def pack565(r, g, b, bgr=False):
+    """Pack 8-bit channels as RGB565 (or BGR565)"""
+    r5 = (r >> 3) & 0x1F
+    g6 = (g >> 2) & 0x3F
+    b5 = (b >> 3) & 0x1F
+    if bgr:
+        return (b5 << 11) | (g6 << 5) | r5
+    return (r5 << 11) | (g6 << 5) | b5
+
+def encode_rows(img, threshold=128, bgr=False):
+    """
+    Encode an RGBA image as a list of uint16 words
+
+    Returns (words, runs, opaque_pixels)
+    """
+    width, height = img.size
+    words = []
+    total_runs = 0
+    opaque = 0
+
+    for y in range(height):
+        row_start = len(words)
+        words.append(0)  # run count, patched below
+        runs = 0
+        x = 0
+        last_end = 0
+        while x < width:
+            if img.getpixel((x, y))[3] < threshold:
+                x += 1
+                continue
+
+            run_start = x
+            while x < width and img.getpixel((x, y))[3] >= threshold:
+                x += 1
+
+            words.append(run_start - last_end)
+            words.append(x - run_start)
+            for px in range(run_start, x):
+                r, g, b, _ = img.getpixel((px, y))
+                words.append(pack565(r, g, b, bgr))
+            opaque += x - run_start
+            last_end = x
+            runs += 1
+
+        words[row_start] = runs
+        total_runs += runs
+
+    return words, total_runs, opaque
+
+def png_to_rle565(png_path, output_path=None, threshold=128, bgr=False):
+    """
+    Convert PNG to a transparent .rle565 sprite
+
+    Args:
+        png_path: Path to input PNG file
+        output_path: Path to output .rle565 file
+        threshold: Alpha at or above this value is opaque
+        bgr: If True, pack pixels as BGR565 instead of RGB565
+    """
+    if not os.path.exists(png_path):
+        print(f"Error: File not found: {png_path}")
+        return False
+
+    if output_path is None:
+        output_path = os.path.splitext(png_path)[0] + '.rle565'
+
+    try:
+        img = Image.open(png_path).convert('RGBA')
+        width, height = img.size
+
+        print(f"Converting {png_path} to transparent RLE ({'BGR565' if bgr else 'RGB565'})")
+
+        words, runs, opaque = encode_rows(img, threshold, bgr)
+
+        with open(output_path, 'wb') as f:
+            f.write(RLE_MAGIC)
+            f.write(struct.pack('<HHI', width, height, len(words)))
+            f.write(struct.pack(f'<{len(words)}H', *words))
+
+        raw_size = width * height * 2
+        rle_size = 12 + len(words) * 2
+        print(f"  {opaque}/{width * height} opaque pixels in {runs} runs")
+        print(f"  {rle_size} bytes ({rle_size * 100 // raw_size}% of raw RGB565)")
+        print(f"  ✓ Saved to {output_path}")
+        return True
+
+    except Exception as e:
+        print(f"Error converting {png_path}: {e}")
+        return False
+
+def batch_convert(directory, threshold=128, bgr=False):
+    """Convert all PNG files in a directory"""
+    converted = 0
+    for filename in os.listdir(directory):
+        if filename.lower().endswith('.png'):
+            if png_to_rle565(os.path.join(directory, filename), threshold=threshold, bgr=bgr):
+                converted += 1
+    print(f"\nBatch conversion complete: {converted} files")
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='PNG to transparent RLE565 Converter')
+    parser.add_argument('input', help='Input PNG file or directory')
+    parser.add_argument('output', nargs='?', help='Output filename (optional)')
+    parser.add_argument('--batch', action='store_true', help='Batch convert directory')
+    parser.add_argument('--threshold', type=int, default=128, help='Alpha threshold for opaque pixels (default 128)')
+    parser.add_argument('--bgr', action='store_true', help='Use BGR565 bit order')
+
+    args = parser.parse_args()
+
+    if args.batch:
+        batch_convert(args.input, threshold=args.threshold, bgr=args.bgr)
+    else:
+        png_to_rle565(args.input, args.output, threshold=args.threshold, bgr=args.bgr)
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+TTF to Smooth Font Converter
+Renders a TrueType/OpenType font at one pixel size into the .vlw format
+TFT_eSPI loads with loadFont() (the format of the library's Processing
+font creator), for the smooth font runs of the B12 glyph cache benchmark
+
+File layout (all values big-endian int32):
+    header: glyph count, version (11), font size, 0, ascent, descent
+    per glyph (28 bytes):
+        unicode, height, width, xAdvance,
+        dY      top of the bitmap above the baseline
+        dX      left of the bitmap from the cursor
+        0       padding
+    per glyph: width*height bytes of 8-bit alpha, row by row
+
+Glyphs default to printable ASCII (space to '~').
+"""
+
+import struct
+import sys
+import os
+
+VLW_VERSION = 11
+
+def glyph_bitmap(font, ch):
+    """Returns (width, height, xAdvance, dY, dX, alpha bytes) for one character"""
+    from PIL import Image, ImageDraw
+    advance = round(font.getlength(ch))
+    left, top, right, bottom = font.getbbox(ch, anchor='ls')
+    width, height = right - left, bottom - top
+    if width <= 0 or height <= 0:
+        return 0, 0, advance, 0, 0, b''
+    img = Image.new('L', (width, height), 0)
+    ImageDraw.Draw(img).text((-left, -top), ch, font=font, fill=255, anchor='ls')
+    return width, height, advance, -top, left, img.tobytes()
+
+def ttf_to_vlw(ttf_path, size, output_path=None, chars=None):
+    """
+    Convert a font to .vlw
+
+    Args:
+        ttf_path: Path to input .ttf/.otf file
+        size: Font size in pixels
+        output_path: Path to output .vlw file
+        chars: Characters to include (default printable ASCII)
+    """
+    from PIL import ImageFont
+    if not os.path.exists(ttf_path):
+        print(f"Error: File not found: {ttf_path}")
+        return False
+
+    if output_path is None:
+        stem = os.path.splitext(os.path.basename(ttf_path))[0]
+        output_path = f"{stem}{size}.vlw"
+    if chars is None:
+        chars = ''.join(chr(c) for c in range(0x20, 0x7F))
+
+    font = ImageFont.truetype(ttf_path, size)
+    ascent, descent = font.getmetrics()
+    glyphs = [(ord(ch),) + glyph_bitmap(font, ch) for ch in sorted(set(chars))]
+
+    with open(output_path, 'wb') as f:
+        f.write(struct.pack('>6i', len(glyphs), VLW_VERSION, size, 0, ascent, descent))
+        for code, width, height, advance, dy, dx, _ in glyphs:
+            f.write(struct.pack('>7i', code, height, width, advance, dy, dx, 0))
+        for *_, bitmap in glyphs:
+            f.write(bitmap)
+
+    total = sum(len(g[-1]) for g in glyphs)
+    print(f"Converting {ttf_path} at {size}px")
+    print(f"  {len(glyphs)} glyphs, ascent {ascent}, descent {descent}, {total} bytes of bitmaps")
+    print(f"  ✓ Saved to {output_path}")
+    return True
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description='TTF to Smooth Font (.vlw) Converter')
+    parser.add_argument('input', help='Input .ttf or .otf file')
+    parser.add_argument('size', type=int, help='Font size in pixels')
+    parser.add_argument('output', nargs='?', help='Output filename (optional)')
+    parser.add_argument('--chars', help='Characters to include (default printable ASCII)')
+
+    args = parser.parse_args()
+
+    if not ttf_to_vlw(args.input, args.size, args.output, args.chars):
+        sys.exit(1)